@@ -0,0 +1,164 @@
+#include "corpus.h"
+#include <benchmark/benchmark.h>
+#include <cedilla/properties.hpp>
+#include <memory>
+#include <vector>
+
+// Batch lookups against the equivalent scalar loops, reported in bytes of UTF-32 input per second
+
+template<typename Corpus>
+static void bench_category_scalar(benchmark::State& state, Corpus make_corpus) {
+    const auto text = make_corpus(1 << 16);
+    std::vector<uni::category> out(text.size());
+    for(auto _ : state) {
+        for(std::size_t i = 0; i < text.size(); i++)
+            out[i] = uni::cp_category(text[i]);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(std::int64_t(state.iterations()) * std::int64_t(text.size() * sizeof(char32_t)));
+}
+
+template<typename Corpus>
+static void bench_category_batch(benchmark::State& state, Corpus make_corpus) {
+    const auto text = make_corpus(1 << 16);
+    std::vector<uni::category> out(text.size());
+    for(auto _ : state) {
+        uni::cp_category(text.data(), text.data() + text.size(), out.data());
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(std::int64_t(state.iterations()) * std::int64_t(text.size() * sizeof(char32_t)));
+}
+
+template<typename Corpus>
+static void bench_script_scalar(benchmark::State& state, Corpus make_corpus) {
+    const auto text = make_corpus(1 << 16);
+    std::vector<uni::script> out(text.size());
+    for(auto _ : state) {
+        for(std::size_t i = 0; i < text.size(); i++)
+            out[i] = uni::cp_script(text[i]);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(std::int64_t(state.iterations()) * std::int64_t(text.size() * sizeof(char32_t)));
+}
+
+template<typename Corpus>
+static void bench_script_batch(benchmark::State& state, Corpus make_corpus) {
+    const auto text = make_corpus(1 << 16);
+    std::vector<uni::script> out(text.size());
+    for(auto _ : state) {
+        uni::cp_script(text.data(), text.data() + text.size(), out.data());
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(std::int64_t(state.iterations()) * std::int64_t(text.size() * sizeof(char32_t)));
+}
+
+template<typename Corpus>
+static void bench_xid_start_scalar(benchmark::State& state, Corpus make_corpus) {
+    const auto text = make_corpus(1 << 16);
+    std::unique_ptr<bool[]> out(new bool[text.size()]);
+    for(auto _ : state) {
+        for(std::size_t i = 0; i < text.size(); i++)
+            out[i] = uni::cp_property_is<uni::property::xid_start>(text[i]);
+        benchmark::DoNotOptimize(out.get());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(std::int64_t(state.iterations()) * std::int64_t(text.size() * sizeof(char32_t)));
+}
+
+template<typename Corpus>
+static void bench_xid_start_batch(benchmark::State& state, Corpus make_corpus) {
+    const auto text = make_corpus(1 << 16);
+    std::unique_ptr<bool[]> out(new bool[text.size()]);
+    for(auto _ : state) {
+        uni::cp_property_is<uni::property::xid_start>(text.data(), text.data() + text.size(), out.get());
+        benchmark::DoNotOptimize(out.get());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(std::int64_t(state.iterations()) * std::int64_t(text.size() * sizeof(char32_t)));
+}
+
+// Batch lookups interleaving the trie walks of distance code points, 0 walking them one at a time,
+// on 4MB of shuffled code points
+template<std::size_t distance, typename Kernel, typename Out>
+static void bench_distance(benchmark::State& state) {
+    const auto text = corpus::shuffled();
+    std::unique_ptr<Out[]> out(new Out[text.size()]);
+    for(auto _ : state) {
+        uni::detail::batch_lookup<distance>(Kernel{}, text.data(), text.data() + text.size(), out.get());
+        benchmark::DoNotOptimize(out.get());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(std::int64_t(state.iterations()) * std::int64_t(text.size() * sizeof(char32_t)));
+}
+
+// Batch lookups with the kernels of each instruction set, scalar, sse42, avx2 and avx512,
+// skipped for those the host lacks
+template<typename Corpus>
+static void bench_category_level(benchmark::State& state, Corpus make_corpus) {
+    const auto level = static_cast<uni::simd_level>(state.range(0));
+    if(!uni::set_batch_simd_level(level)) {
+        state.SkipWithError("instruction set not supported by the host");
+        return;
+    }
+    const auto text = make_corpus(1 << 16);
+    std::vector<uni::category> out(text.size());
+    for(auto _ : state) {
+        uni::cp_category(text.data(), text.data() + text.size(), out.data());
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    uni::set_batch_simd_level(uni::host_simd_level());
+    state.SetBytesProcessed(std::int64_t(state.iterations()) * std::int64_t(text.size() * sizeof(char32_t)));
+}
+
+BENCHMARK_CAPTURE(bench_category_level, mixed, corpus::mixed)->DenseRange(0, 3);
+BENCHMARK_CAPTURE(bench_category_level, shuffled, corpus::shuffled)->DenseRange(0, 3);
+
+BENCHMARK_CAPTURE(bench_category_scalar, shuffled, corpus::shuffled);
+BENCHMARK_TEMPLATE(bench_distance, 0, uni::detail::category_kernel, uni::category);
+BENCHMARK_TEMPLATE(bench_distance, 16, uni::detail::category_kernel, uni::category);
+BENCHMARK_TEMPLATE(bench_distance, 32, uni::detail::category_kernel, uni::category);
+BENCHMARK_TEMPLATE(bench_distance, 64, uni::detail::category_kernel, uni::category);
+BENCHMARK_TEMPLATE(bench_distance, 128, uni::detail::category_kernel, uni::category);
+BENCHMARK_CAPTURE(bench_script_scalar, shuffled, corpus::shuffled);
+BENCHMARK_TEMPLATE(bench_distance, 0, uni::detail::script_kernel, uni::script);
+BENCHMARK_TEMPLATE(bench_distance, 16, uni::detail::script_kernel, uni::script);
+BENCHMARK_TEMPLATE(bench_distance, 32, uni::detail::script_kernel, uni::script);
+BENCHMARK_TEMPLATE(bench_distance, 64, uni::detail::script_kernel, uni::script);
+BENCHMARK_TEMPLATE(bench_distance, 128, uni::detail::script_kernel, uni::script);
+BENCHMARK_CAPTURE(bench_xid_start_scalar, shuffled, corpus::shuffled);
+BENCHMARK_TEMPLATE(bench_distance, 0, uni::detail::property_kernel<uni::property::xid_start>, bool);
+BENCHMARK_TEMPLATE(bench_distance, 16, uni::detail::property_kernel<uni::property::xid_start>, bool);
+BENCHMARK_TEMPLATE(bench_distance, 32, uni::detail::property_kernel<uni::property::xid_start>, bool);
+BENCHMARK_TEMPLATE(bench_distance, 64, uni::detail::property_kernel<uni::property::xid_start>, bool);
+BENCHMARK_TEMPLATE(bench_distance, 128, uni::detail::property_kernel<uni::property::xid_start>, bool);
+
+BENCHMARK_CAPTURE(bench_category_scalar, ascii, corpus::ascii);
+BENCHMARK_CAPTURE(bench_category_scalar, cjk, corpus::cjk);
+BENCHMARK_CAPTURE(bench_category_scalar, mixed, corpus::mixed);
+
+BENCHMARK_CAPTURE(bench_category_batch, ascii, corpus::ascii);
+BENCHMARK_CAPTURE(bench_category_batch, cjk, corpus::cjk);
+BENCHMARK_CAPTURE(bench_category_batch, mixed, corpus::mixed);
+
+BENCHMARK_CAPTURE(bench_script_scalar, ascii, corpus::ascii);
+BENCHMARK_CAPTURE(bench_script_scalar, cjk, corpus::cjk);
+BENCHMARK_CAPTURE(bench_script_scalar, mixed, corpus::mixed);
+
+BENCHMARK_CAPTURE(bench_script_batch, ascii, corpus::ascii);
+BENCHMARK_CAPTURE(bench_script_batch, cjk, corpus::cjk);
+BENCHMARK_CAPTURE(bench_script_batch, mixed, corpus::mixed);
+
+BENCHMARK_CAPTURE(bench_xid_start_scalar, ascii, corpus::ascii);
+BENCHMARK_CAPTURE(bench_xid_start_scalar, cjk, corpus::cjk);
+BENCHMARK_CAPTURE(bench_xid_start_scalar, mixed, corpus::mixed);
+
+BENCHMARK_CAPTURE(bench_xid_start_batch, ascii, corpus::ascii);
+BENCHMARK_CAPTURE(bench_xid_start_batch, cjk, corpus::cjk);
+BENCHMARK_CAPTURE(bench_xid_start_batch, mixed, corpus::mixed);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,20 @@
+#include "corpus.h"
+#include <benchmark/benchmark.h>
+#include <cedilla/properties.hpp>
+
+template<typename Corpus>
+static void bench_block(benchmark::State& state, Corpus make_corpus) {
+    const auto text = make_corpus(1 << 16);
+    for(auto _ : state) {
+        for(char32_t c : text) {
+            benchmark::DoNotOptimize(uni::cp_block(c));
+        }
+    }
+    state.SetItemsProcessed(std::int64_t(state.iterations()) * std::int64_t(text.size()));
+}
+
+BENCHMARK_CAPTURE(bench_block, ascii, corpus::ascii);
+BENCHMARK_CAPTURE(bench_block, cjk, corpus::cjk);
+BENCHMARK_CAPTURE(bench_block, mixed, corpus::mixed);
+
+BENCHMARK_MAIN();
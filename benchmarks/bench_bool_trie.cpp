@@ -0,0 +1,92 @@
+#include "corpus.h"
+#include <benchmark/benchmark.h>
+#include <cedilla/properties.hpp>
+
+// Trimmed bool_trie lookups, which branch on the range of the code point,
+// against the branch free lookups of the padded layout on the same data.
+// prop_assigned, the only bool_trie of the header, is padded: the trimmed copy drops the
+// leading and trailing 0 entries of its stages, which the trimmed lookups read as 0.
+// The header must be generated with a policy keeping it a trie, balanced or latency.
+// Branch misses are reported with --benchmark_perf_counters=BRANCH-MISSES
+// when Google Benchmark is built with libpfm.
+
+using namespace uni::detail;
+
+namespace {
+
+template<typename T, std::size_t n>
+constexpr std::size_t leading_zeros(const T (&a)[n]) {
+    std::size_t i = 0;
+    while(i < n && a[i] == 0)
+        i++;
+    return i;
+}
+
+// the zeros not counted by leading_zeros
+template<typename T, std::size_t n>
+constexpr std::size_t trailing_zeros(const T (&a)[n]) {
+    std::size_t i = 0;
+    while(i < n - leading_zeros(a) && a[n - 1 - i] == 0)
+        i++;
+    return i;
+}
+
+// Copy of a padded trie without the f front and b back entries of its stages
+template<std::size_t f2, std::size_t b2, std::size_t f4, std::size_t b4, std::size_t f5, std::size_t b5,
+         std::size_t r1_s, std::size_t r2_s, std::size_t r3_s, std::size_t r4_s, std::size_t r5_s, std::size_t r6_s>
+constexpr auto trimmed(const bool_trie<r1_s, r2_s, 0, 0, r3_s, r4_s, 0, 0, r5_s, 0, 0, r6_s, trie_layout::padded>& t) {
+    static_assert(r3_s != 0 && r6_s != 0);
+    bool_trie<r1_s, r2_s - f2 - b2, f2, b2, r3_s, r4_s - f4 - b4, f4, b4, r5_s - f5 - b5, f5, b5, r6_s,
+              trie_layout::trimmed>
+        p{};
+    for(std::size_t i = 0; i < 32; i++)
+        p.r1[i] = t.r1[i];
+    for(std::size_t i = 0; i < r2_s - f2 - b2; i++)
+        p.r2[i] = t.r2[i + f2];
+    for(std::size_t i = 0; i < r3_s; i++)
+        p.r3[i] = t.r3[i];
+    for(std::size_t i = 0; i < r4_s - f4 - b4; i++)
+        p.r4[i] = t.r4[i + f4];
+    for(std::size_t i = 0; i < r5_s - f5 - b5; i++)
+        p.r5[i] = t.r5[i + f5];
+    for(std::size_t i = 0; i < r6_s; i++)
+        p.r6[i] = t.r6[i];
+    return p;
+}
+
+constexpr const auto& assigned_padded = tables::prop_assigned;
+constexpr auto assigned_trimmed =
+    trimmed<leading_zeros(assigned_padded.r2), trailing_zeros(assigned_padded.r2), leading_zeros(assigned_padded.r4),
+            trailing_zeros(assigned_padded.r4), leading_zeros(assigned_padded.r5), trailing_zeros(assigned_padded.r5)>(
+        assigned_padded);
+
+// Code points drawn from scripts of the three ranges of the trie
+std::u32string script_mix(std::size_t size) {
+    return corpus::from_ranges<8>(size, {corpus::range{'a', 'z'}, corpus::range{0xC0, 0x24F},
+                                         corpus::range{0x400, 0x4FF}, corpus::range{0x900, 0x97F},
+                                         corpus::range{0x4E00, 0x9FFF}, corpus::range{0xAC00, 0xD7A3},
+                                         corpus::range{0x1F300, 0x1FAFF}, corpus::range{0x20000, 0x2A6DF}});
+}
+
+}    // namespace
+
+template<typename Trie, typename Corpus>
+static void bench_lookup(benchmark::State& state, const Trie& trie, Corpus make_corpus) {
+    const auto text = make_corpus(1 << 16);
+    for(auto _ : state) {
+        std::size_t count = 0;
+        for(char32_t c : text)
+            count += trie.lookup(c);
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetItemsProcessed(std::int64_t(state.iterations()) * std::int64_t(text.size()));
+}
+
+BENCHMARK_CAPTURE(bench_lookup, assigned_trimmed_ascii, assigned_trimmed, corpus::ascii);
+BENCHMARK_CAPTURE(bench_lookup, assigned_trimmed_mixed, assigned_trimmed, corpus::mixed);
+BENCHMARK_CAPTURE(bench_lookup, assigned_trimmed_script_mix, assigned_trimmed, script_mix);
+BENCHMARK_CAPTURE(bench_lookup, assigned_padded_ascii, assigned_padded, corpus::ascii);
+BENCHMARK_CAPTURE(bench_lookup, assigned_padded_mixed, assigned_padded, corpus::mixed);
+BENCHMARK_CAPTURE(bench_lookup, assigned_padded_script_mix, assigned_padded, script_mix);
+
+BENCHMARK_MAIN();
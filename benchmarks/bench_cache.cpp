@@ -0,0 +1,82 @@
+#include "corpus.h"
+#include <benchmark/benchmark.h>
+#include <cedilla/properties.hpp>
+#include <cstdint>
+#include <set>
+
+// Lookups of representative corpora, with the cache lines and pages of the tables they read.
+// lines and pages count the distinct 64 bytes lines and 4KB pages of category_data, cp_info_data,
+// cp_info_records, property_data and property_rows read by the lookups of the corpus: the working set
+// that has to fit in L1 and the TLB. Cache misses are reported with
+// --benchmark_perf_counters=L1-DCACHE-LOAD-MISSES,LLC-LOAD-MISSES when Google Benchmark is built with libpfm.
+
+using namespace uni;
+using namespace uni::detail;
+
+namespace {
+
+struct working_set {
+    std::set<std::uintptr_t> lines;
+    std::set<std::uintptr_t> pages;
+
+    void touch(const void* p) {
+        const auto a = reinterpret_cast<std::uintptr_t>(p);
+        lines.insert(a / 64);
+        pages.insert(a / 4096);
+    }
+
+    // Entries of the trie read by trie.lookup(c, default), which returns its value
+    template<typename T, std::size_t s1_s, std::size_t s2_s, std::size_t s3_s, unsigned mid_bits, unsigned leaf_bits>
+    std::size_t walk(const value_trie<T, s1_s, s2_s, s3_s, mid_bits, leaf_bits>& trie, char32_t c) {
+        const std::size_t i1 = c >> (mid_bits + leaf_bits);
+        if(i1 >= s1_s)
+            return 0;
+        touch(&trie.s1[i1]);
+        const std::size_t i2 = (std::size_t(trie.s1[i1]) << mid_bits) | ((c >> leaf_bits) & ((1u << mid_bits) - 1));
+        touch(&trie.s2[i2]);
+        const std::size_t i3 = (std::size_t(trie.s2[i2]) << leaf_bits) | (c & ((1u << leaf_bits) - 1));
+        touch(&trie.s3[i3]);
+        return trie.s3[i3];
+    }
+};
+
+// Tables read by cp_category, cp_script and cp_property_is, Latin-1 being read from latin1_data
+working_set tables_of(const std::u32string& text) {
+    working_set w;
+    for(char32_t c : text) {
+        if(c <= 0xFF) {
+            w.touch(&tables::latin1_data[c]);
+            continue;
+        }
+        w.walk(tables::category_data, c);
+        w.touch(&tables::cp_info_records[w.walk(tables::cp_info_data, c)]);
+        w.touch(&tables::property_rows[w.walk(tables::property_data, c)]);
+    }
+    return w;
+}
+
+}    // namespace
+
+template<typename Corpus>
+static void bench_lookups(benchmark::State& state, Corpus make_corpus) {
+    const auto text = make_corpus(1 << 16);
+    for(auto _ : state) {
+        for(char32_t c : text) {
+            benchmark::DoNotOptimize(cp_category(c));
+            benchmark::DoNotOptimize(cp_info(c).script());
+            benchmark::DoNotOptimize(cp_property_is<property::alphabetic>(c));
+        }
+    }
+    const auto w = tables_of(text);
+    state.counters["lines"] = double(w.lines.size());
+    state.counters["pages"] = double(w.pages.size());
+    state.SetItemsProcessed(std::int64_t(state.iterations()) * std::int64_t(text.size()));
+}
+
+BENCHMARK_CAPTURE(bench_lookups, ascii, corpus::ascii);
+BENCHMARK_CAPTURE(bench_lookups, cyrillic, corpus::cyrillic);
+BENCHMARK_CAPTURE(bench_lookups, cjk, corpus::cjk);
+BENCHMARK_CAPTURE(bench_lookups, mixed, corpus::mixed);
+BENCHMARK_CAPTURE(bench_lookups, shuffled, corpus::shuffled);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,67 @@
+#include "corpus.h"
+#include <benchmark/benchmark.h>
+#include <cedilla/properties.hpp>
+
+template<typename Corpus>
+static void bench_category(benchmark::State& state, Corpus make_corpus) {
+    const auto text = make_corpus(1 << 16);
+    for(auto _ : state) {
+        for(char32_t c : text) {
+            benchmark::DoNotOptimize(uni::cp_category(c));
+        }
+    }
+    state.SetItemsProcessed(std::int64_t(state.iterations()) * std::int64_t(text.size()));
+}
+
+template<typename Corpus>
+static void bench_category_is_letter(benchmark::State& state, Corpus make_corpus) {
+    const auto text = make_corpus(1 << 16);
+    for(auto _ : state) {
+        for(char32_t c : text) {
+            benchmark::DoNotOptimize(uni::cp_category_is<uni::category::letter>(c));
+        }
+    }
+    state.SetItemsProcessed(std::int64_t(state.iterations()) * std::int64_t(text.size()));
+}
+
+template<typename Corpus>
+static void bench_letter_or_number_is(benchmark::State& state, Corpus make_corpus) {
+    const auto text = make_corpus(1 << 16);
+    for(auto _ : state) {
+        for(char32_t c : text) {
+            benchmark::DoNotOptimize(uni::cp_category_is<uni::category::letter>(c) ||
+                                     uni::cp_category_is<uni::category::number>(c));
+        }
+    }
+    state.SetItemsProcessed(std::int64_t(state.iterations()) * std::int64_t(text.size()));
+}
+
+template<typename Corpus>
+static void bench_letter_or_number_in(benchmark::State& state, Corpus make_corpus) {
+    const auto text = make_corpus(1 << 16);
+    constexpr uni::category_mask mask = uni::category::letter | uni::category::number;
+    for(auto _ : state) {
+        for(char32_t c : text) {
+            benchmark::DoNotOptimize(uni::cp_category_in(c, mask));
+        }
+    }
+    state.SetItemsProcessed(std::int64_t(state.iterations()) * std::int64_t(text.size()));
+}
+
+BENCHMARK_CAPTURE(bench_category, ascii, corpus::ascii);
+BENCHMARK_CAPTURE(bench_category, cjk, corpus::cjk);
+BENCHMARK_CAPTURE(bench_category, mixed, corpus::mixed);
+
+BENCHMARK_CAPTURE(bench_category_is_letter, ascii, corpus::ascii);
+BENCHMARK_CAPTURE(bench_category_is_letter, cjk, corpus::cjk);
+BENCHMARK_CAPTURE(bench_category_is_letter, mixed, corpus::mixed);
+
+BENCHMARK_CAPTURE(bench_letter_or_number_is, ascii, corpus::ascii);
+BENCHMARK_CAPTURE(bench_letter_or_number_is, cjk, corpus::cjk);
+BENCHMARK_CAPTURE(bench_letter_or_number_is, mixed, corpus::mixed);
+
+BENCHMARK_CAPTURE(bench_letter_or_number_in, ascii, corpus::ascii);
+BENCHMARK_CAPTURE(bench_letter_or_number_in, cjk, corpus::cjk);
+BENCHMARK_CAPTURE(bench_letter_or_number_in, mixed, corpus::mixed);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,44 @@
+#include "corpus.h"
+#include <benchmark/benchmark.h>
+#include <cedilla/properties.hpp>
+
+template<typename Corpus>
+static void bench_individual_calls(benchmark::State& state, Corpus make_corpus) {
+    const auto text = make_corpus(1 << 16);
+    for(auto _ : state) {
+        for(char32_t c : text) {
+            benchmark::DoNotOptimize(uni::cp_category(c));
+            benchmark::DoNotOptimize(uni::cp_script(c));
+            benchmark::DoNotOptimize(uni::cp_block(c));
+            benchmark::DoNotOptimize(uni::cp_age(c));
+        }
+    }
+    state.SetItemsProcessed(std::int64_t(state.iterations()) * std::int64_t(text.size()));
+}
+
+template<typename Corpus>
+static void bench_cp_info(benchmark::State& state, Corpus make_corpus) {
+    const auto text = make_corpus(1 << 16);
+    for(auto _ : state) {
+        for(char32_t c : text) {
+            const auto info = uni::cp_info(c);
+            benchmark::DoNotOptimize(info.category());
+            benchmark::DoNotOptimize(info.script());
+            benchmark::DoNotOptimize(info.block());
+            benchmark::DoNotOptimize(info.age());
+        }
+    }
+    state.SetItemsProcessed(std::int64_t(state.iterations()) * std::int64_t(text.size()));
+    state.counters["table_bytes"] = double(sizeof(uni::detail::tables::cp_info_data) +
+                                           sizeof(uni::detail::tables::cp_info_records));
+}
+
+BENCHMARK_CAPTURE(bench_individual_calls, ascii, corpus::ascii);
+BENCHMARK_CAPTURE(bench_individual_calls, cjk, corpus::cjk);
+BENCHMARK_CAPTURE(bench_individual_calls, mixed, corpus::mixed);
+
+BENCHMARK_CAPTURE(bench_cp_info, ascii, corpus::ascii);
+BENCHMARK_CAPTURE(bench_cp_info, cjk, corpus::cjk);
+BENCHMARK_CAPTURE(bench_cp_info, mixed, corpus::mixed);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,52 @@
+#include "corpus.h"
+#include <benchmark/benchmark.h>
+#include <cedilla/properties.hpp>
+
+// Lookups of sequential text with a lookup_cursor, against the lookups that search every time
+
+using namespace uni;
+
+template<typename F, typename Corpus>
+static void bench_lookup(benchmark::State& state, F f, Corpus make_corpus) {
+    const auto text = make_corpus(1 << 16);
+    for(auto _ : state) {
+        lookup_cursor cursor;
+        for(char32_t c : text)
+            benchmark::DoNotOptimize(f(cursor, c));
+    }
+    state.SetItemsProcessed(std::int64_t(state.iterations()) * std::int64_t(text.size()));
+}
+
+namespace {
+
+const auto script_of = [](lookup_cursor&, char32_t c) { return cp_script(c); };
+const auto cursor_script_of = [](lookup_cursor& cursor, char32_t c) { return cursor.cp_script(c); };
+const auto age_of = [](lookup_cursor&, char32_t c) { return cp_age(c); };
+const auto cursor_age_of = [](lookup_cursor& cursor, char32_t c) { return cursor.cp_age(c); };
+const auto block_of = [](lookup_cursor&, char32_t c) { return cp_block(c); };
+const auto cursor_block_of = [](lookup_cursor& cursor, char32_t c) { return cursor.cp_block(c); };
+
+}    // namespace
+
+BENCHMARK_CAPTURE(bench_lookup, script_cyrillic, script_of, corpus::cyrillic);
+BENCHMARK_CAPTURE(bench_lookup, script_cjk, script_of, corpus::cjk);
+BENCHMARK_CAPTURE(bench_lookup, script_mixed, script_of, corpus::mixed);
+BENCHMARK_CAPTURE(bench_lookup, cursor_script_cyrillic, cursor_script_of, corpus::cyrillic);
+BENCHMARK_CAPTURE(bench_lookup, cursor_script_cjk, cursor_script_of, corpus::cjk);
+BENCHMARK_CAPTURE(bench_lookup, cursor_script_mixed, cursor_script_of, corpus::mixed);
+
+BENCHMARK_CAPTURE(bench_lookup, age_cyrillic, age_of, corpus::cyrillic);
+BENCHMARK_CAPTURE(bench_lookup, age_cjk, age_of, corpus::cjk);
+BENCHMARK_CAPTURE(bench_lookup, age_mixed, age_of, corpus::mixed);
+BENCHMARK_CAPTURE(bench_lookup, cursor_age_cyrillic, cursor_age_of, corpus::cyrillic);
+BENCHMARK_CAPTURE(bench_lookup, cursor_age_cjk, cursor_age_of, corpus::cjk);
+BENCHMARK_CAPTURE(bench_lookup, cursor_age_mixed, cursor_age_of, corpus::mixed);
+
+BENCHMARK_CAPTURE(bench_lookup, block_cyrillic, block_of, corpus::cyrillic);
+BENCHMARK_CAPTURE(bench_lookup, block_cjk, block_of, corpus::cjk);
+BENCHMARK_CAPTURE(bench_lookup, block_mixed, block_of, corpus::mixed);
+BENCHMARK_CAPTURE(bench_lookup, cursor_block_cyrillic, cursor_block_of, corpus::cyrillic);
+BENCHMARK_CAPTURE(bench_lookup, cursor_block_cjk, cursor_block_of, corpus::cjk);
+BENCHMARK_CAPTURE(bench_lookup, cursor_block_mixed, cursor_block_of, corpus::mixed);
+
+BENCHMARK_MAIN();
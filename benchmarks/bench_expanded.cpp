@@ -0,0 +1,97 @@
+#include "corpus.h"
+#include <benchmark/benchmark.h>
+#include <cedilla/properties.hpp>
+#include <cedilla/expanded.hpp>
+
+// Lookups from the expanded tables against the compressed ones, and the cost of expanding them.
+// bench_first_use counts the expansion in: it shows how many lookups pay for it.
+
+using namespace uni;
+
+namespace {
+
+const auto category_of = [](char32_t c) { return cp_category(c); };
+const auto expanded_category_of = [](char32_t c) { return expanded::cp_category(c); };
+const auto script_of = [](char32_t c) { return cp_script(c); };
+const auto expanded_script_of = [](char32_t c) { return expanded::cp_script(c); };
+const auto age_of = [](char32_t c) { return cp_age(c); };
+const auto expanded_age_of = [](char32_t c) { return expanded::cp_age(c); };
+const auto alpha_of = [](char32_t c) { return cp_property_is<property::alphabetic>(c); };
+const auto expanded_alpha_of = [](char32_t c) { return expanded::cp_property_is<property::alphabetic>(c); };
+
+}    // namespace
+
+template<typename F, typename Corpus>
+static void bench_lookup(benchmark::State& state, F f, Corpus make_corpus) {
+    const auto text = make_corpus(1 << 16);
+    f(0);
+    for(auto _ : state) {
+        for(char32_t c : text)
+            benchmark::DoNotOptimize(f(c));
+    }
+    state.SetItemsProcessed(std::int64_t(state.iterations()) * std::int64_t(text.size()));
+}
+
+static void bench_expand_category(benchmark::State& state) {
+    for(auto _ : state)
+        benchmark::DoNotOptimize(detail::expand_values([](char32_t c) { return cp_category(c); }));
+}
+
+static void bench_expand_script(benchmark::State& state) {
+    for(auto _ : state)
+        benchmark::DoNotOptimize(detail::expand_values([](char32_t c) { return cp_script(c); }));
+}
+
+static void bench_expand_alphabetic(benchmark::State& state) {
+    for(auto _ : state)
+        benchmark::DoNotOptimize(detail::expand_property(property::alphabetic));
+}
+
+// state.range(0) script lookups of mixed text, the expanded ones building their table first
+static void bench_first_use_compressed(benchmark::State& state) {
+    const auto text = corpus::mixed(1 << 16);
+    const auto n = std::size_t(state.range(0));
+    for(auto _ : state) {
+        for(std::size_t i = 0; i < n; i++)
+            benchmark::DoNotOptimize(cp_script(text[i & 0xFFFF]));
+    }
+}
+
+static void bench_first_use_expanded(benchmark::State& state) {
+    const auto text = corpus::mixed(1 << 16);
+    const auto n = std::size_t(state.range(0));
+    for(auto _ : state) {
+        const auto table = detail::expand_values([](char32_t c) { return cp_script(c); });
+        for(std::size_t i = 0; i < n; i++)
+            benchmark::DoNotOptimize(table[text[i & 0xFFFF]]);
+    }
+}
+
+BENCHMARK_CAPTURE(bench_lookup, category_cjk, category_of, corpus::cjk);
+BENCHMARK_CAPTURE(bench_lookup, category_mixed, category_of, corpus::mixed);
+BENCHMARK_CAPTURE(bench_lookup, expanded_category_cjk, expanded_category_of, corpus::cjk);
+BENCHMARK_CAPTURE(bench_lookup, expanded_category_mixed, expanded_category_of, corpus::mixed);
+
+BENCHMARK_CAPTURE(bench_lookup, script_cjk, script_of, corpus::cjk);
+BENCHMARK_CAPTURE(bench_lookup, script_mixed, script_of, corpus::mixed);
+BENCHMARK_CAPTURE(bench_lookup, expanded_script_cjk, expanded_script_of, corpus::cjk);
+BENCHMARK_CAPTURE(bench_lookup, expanded_script_mixed, expanded_script_of, corpus::mixed);
+
+BENCHMARK_CAPTURE(bench_lookup, age_cjk, age_of, corpus::cjk);
+BENCHMARK_CAPTURE(bench_lookup, age_mixed, age_of, corpus::mixed);
+BENCHMARK_CAPTURE(bench_lookup, expanded_age_cjk, expanded_age_of, corpus::cjk);
+BENCHMARK_CAPTURE(bench_lookup, expanded_age_mixed, expanded_age_of, corpus::mixed);
+
+BENCHMARK_CAPTURE(bench_lookup, alphabetic_cjk, alpha_of, corpus::cjk);
+BENCHMARK_CAPTURE(bench_lookup, alphabetic_mixed, alpha_of, corpus::mixed);
+BENCHMARK_CAPTURE(bench_lookup, expanded_alphabetic_cjk, expanded_alpha_of, corpus::cjk);
+BENCHMARK_CAPTURE(bench_lookup, expanded_alphabetic_mixed, expanded_alpha_of, corpus::mixed);
+
+BENCHMARK(bench_expand_category)->Unit(benchmark::kMillisecond);
+BENCHMARK(bench_expand_script)->Unit(benchmark::kMillisecond);
+BENCHMARK(bench_expand_alphabetic)->Unit(benchmark::kMillisecond);
+
+BENCHMARK(bench_first_use_compressed)->RangeMultiplier(4)->Range(1 << 14, 1 << 24)->Unit(benchmark::kMillisecond);
+BENCHMARK(bench_first_use_expanded)->RangeMultiplier(4)->Range(1 << 14, 1 << 24)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
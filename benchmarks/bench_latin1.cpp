@@ -0,0 +1,71 @@
+#include "corpus.h"
+#include <benchmark/benchmark.h>
+#include <cedilla/properties.hpp>
+
+// Latency of lookups of code points of ASCII, Latin-1 and the rest of the BMP.
+// Each code point looked up depends on the result of the previous lookup.
+
+using namespace uni;
+
+namespace {
+
+std::u32string latin1(std::size_t size) {
+    return corpus::from_ranges<1>(size, {corpus::range{0x80, 0xFF}});
+}
+
+std::u32string ascii(std::size_t size) {
+    return corpus::from_ranges<1>(size, {corpus::range{0x00, 0x7F}});
+}
+
+std::u32string bmp(std::size_t size) {
+    return corpus::from_ranges<1>(size, {corpus::range{0x100, 0xFFFF}});
+}
+
+const auto category_of = [](char32_t c) { return cp_category(c); };
+const auto script_of = [](char32_t c) { return cp_script(c); };
+const auto block_of = [](char32_t c) { return cp_block(c); };
+const auto age_of = [](char32_t c) { return cp_age(c); };
+const auto info_of = [](char32_t c) { return cp_info(c).script(); };
+const auto alphabetic_of = [](char32_t c) { return cp_property_is<property::alphabetic>(c); };
+
+}    // namespace
+
+template<typename F, typename Corpus>
+static void bench_latency(benchmark::State& state, F f, Corpus make_corpus) {
+    const auto text = make_corpus(1 << 16);
+    std::size_t i = 0;
+    for(auto _ : state) {
+        for(std::size_t n = 0; n < text.size(); n++) {
+            const auto r = f(text[i]);
+            i = (i + 1 + (std::size_t(r) & 1)) & (text.size() - 1);
+        }
+    }
+    benchmark::DoNotOptimize(i);
+    state.SetItemsProcessed(std::int64_t(state.iterations()) * std::int64_t(text.size()));
+}
+
+BENCHMARK_CAPTURE(bench_latency, category_ascii, category_of, ascii);
+BENCHMARK_CAPTURE(bench_latency, category_latin1, category_of, latin1);
+BENCHMARK_CAPTURE(bench_latency, category_bmp, category_of, bmp);
+
+BENCHMARK_CAPTURE(bench_latency, script_ascii, script_of, ascii);
+BENCHMARK_CAPTURE(bench_latency, script_latin1, script_of, latin1);
+BENCHMARK_CAPTURE(bench_latency, script_bmp, script_of, bmp);
+
+BENCHMARK_CAPTURE(bench_latency, block_ascii, block_of, ascii);
+BENCHMARK_CAPTURE(bench_latency, block_latin1, block_of, latin1);
+BENCHMARK_CAPTURE(bench_latency, block_bmp, block_of, bmp);
+
+BENCHMARK_CAPTURE(bench_latency, age_ascii, age_of, ascii);
+BENCHMARK_CAPTURE(bench_latency, age_latin1, age_of, latin1);
+BENCHMARK_CAPTURE(bench_latency, age_bmp, age_of, bmp);
+
+BENCHMARK_CAPTURE(bench_latency, info_ascii, info_of, ascii);
+BENCHMARK_CAPTURE(bench_latency, info_latin1, info_of, latin1);
+BENCHMARK_CAPTURE(bench_latency, info_bmp, info_of, bmp);
+
+BENCHMARK_CAPTURE(bench_latency, alphabetic_ascii, alphabetic_of, ascii);
+BENCHMARK_CAPTURE(bench_latency, alphabetic_latin1, alphabetic_of, latin1);
+BENCHMARK_CAPTURE(bench_latency, alphabetic_bmp, alphabetic_of, bmp);
+
+BENCHMARK_MAIN();
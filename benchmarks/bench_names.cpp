@@ -0,0 +1,30 @@
+#include <benchmark/benchmark.h>
+#include <cedilla/properties.hpp>
+#include <string_view>
+
+// Names as written by users in queries and regular expressions, in various spellings
+static constexpr std::string_view binary_props[] = {
+    "Alphabetic", "White_Space", "whitespace", "Emoji", "Lu", "Uppercase_Letter", "Greek", "Old Italic",
+    "scx=Arabic", "Script_Extensions=Hani", "Any", "ASCII", "Nd", "Ideographic", "XID-Continue", "unknown-prop"};
+
+static constexpr std::string_view scripts[] = {"Latin", "latn", "Greek", "Cyrillic", "Han", "Hiragana",
+                                               "Old_Italic", "old italic", "Arabic", "Zzzz"};
+
+static constexpr std::string_view blocks[] = {"Basic Latin", "basic_latin", "CJK Unified Ideographs",
+                                              "Greek and Coptic", "Emoticons", "Hangul Syllables"};
+
+template<typename F, std::size_t N>
+static void bench_names(benchmark::State& state, F from_string, const std::string_view (&names)[N]) {
+    for(auto _ : state) {
+        for(const auto& name : names) {
+            benchmark::DoNotOptimize(from_string(name));
+        }
+    }
+    state.SetItemsProcessed(std::int64_t(state.iterations()) * std::int64_t(N));
+}
+
+BENCHMARK_CAPTURE(bench_names, binary_prop, uni::detail::binary_prop_from_string, binary_props);
+BENCHMARK_CAPTURE(bench_names, script, uni::detail::script_from_string, scripts);
+BENCHMARK_CAPTURE(bench_names, block, uni::detail::block_from_string, blocks);
+
+BENCHMARK_MAIN();
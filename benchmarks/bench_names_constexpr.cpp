@@ -0,0 +1,35 @@
+#include <cedilla/properties.hpp>
+
+// Compile time benchmark: the time it takes to build this file is the time the compiler spends
+// parsing property names, as ctre does for \p{...}
+using uni::detail::binary_prop;
+using uni::detail::binary_prop_from_string;
+
+#define CHECK_NAME(name) static_assert(binary_prop_from_string(name) != binary_prop::unknown);
+#define CHECK_SCRIPT(name) \
+    CHECK_NAME(name)       \
+    CHECK_NAME("scx=" name) CHECK_NAME("Script_Extensions=" name)
+
+CHECK_NAME("Alphabetic")
+CHECK_NAME("White_Space")
+CHECK_NAME("Lowercase_Letter")
+CHECK_NAME("Decimal Number")
+CHECK_NAME("Extended_Pictographic")
+CHECK_NAME("XID_Continue")
+CHECK_SCRIPT("Latin")
+CHECK_SCRIPT("Greek")
+CHECK_SCRIPT("Cyrillic")
+CHECK_SCRIPT("Arabic")
+CHECK_SCRIPT("Hebrew")
+CHECK_SCRIPT("Devanagari")
+CHECK_SCRIPT("Han")
+CHECK_SCRIPT("Hiragana")
+CHECK_SCRIPT("Katakana")
+CHECK_SCRIPT("Hangul")
+CHECK_SCRIPT("Thai")
+CHECK_SCRIPT("Zyyy")
+CHECK_SCRIPT("Yi")
+CHECK_SCRIPT("Old_Italic")
+CHECK_SCRIPT("Zanabazar_Square")
+
+int main() {}
@@ -0,0 +1,28 @@
+#include "corpus.h"
+#include <benchmark/benchmark.h>
+#include <cedilla/properties.hpp>
+
+template<typename Corpus>
+static void bench_numeric_value(benchmark::State& state, Corpus make_corpus) {
+    const auto text = make_corpus(1 << 16);
+    for(auto _ : state) {
+        for(char32_t c : text) {
+            benchmark::DoNotOptimize(uni::cp_numeric_value(c));
+        }
+    }
+    state.SetItemsProcessed(std::int64_t(state.iterations()) * std::int64_t(text.size()));
+}
+
+// digits of several scripts, roman numerals, fractions and CJK numerals
+static std::u32string numbers(std::size_t size) {
+    return corpus::from_ranges<6>(size, {corpus::range{'0', '9'}, corpus::range{0x660, 0x669},
+                                         corpus::range{0x966, 0x96F}, corpus::range{0x2150, 0x2188},
+                                         corpus::range{0xBC, 0xBE}, corpus::range{0x1F100, 0x1F10C}});
+}
+
+BENCHMARK_CAPTURE(bench_numeric_value, ascii, corpus::ascii);
+BENCHMARK_CAPTURE(bench_numeric_value, cjk, corpus::cjk);
+BENCHMARK_CAPTURE(bench_numeric_value, mixed, corpus::mixed);
+BENCHMARK_CAPTURE(bench_numeric_value, numbers, numbers);
+
+BENCHMARK_MAIN();
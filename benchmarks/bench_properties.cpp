@@ -0,0 +1,49 @@
+#include "corpus.h"
+#include <benchmark/benchmark.h>
+#include <cedilla/properties.hpp>
+
+// The questions a typical lexer asks for each character
+
+// One query per property, each reading the row of c
+template<typename Corpus>
+static void bench_cp_property_is(benchmark::State& state, Corpus make_corpus) {
+    using uni::property;
+    const auto text = make_corpus(1 << 16);
+    for(auto _ : state) {
+        for(char32_t c : text) {
+            benchmark::DoNotOptimize(uni::cp_property_is<property::xids>(c));
+            benchmark::DoNotOptimize(uni::cp_property_is<property::xidc>(c));
+            benchmark::DoNotOptimize(uni::cp_property_is<property::wspace>(c));
+            benchmark::DoNotOptimize(uni::cp_property_is<property::pat_syn>(c));
+            benchmark::DoNotOptimize(uni::cp_property_is<property::emoji>(c));
+        }
+    }
+    state.SetItemsProcessed(std::int64_t(state.iterations()) * std::int64_t(text.size()));
+}
+
+template<typename Corpus>
+static void bench_cp_properties(benchmark::State& state, Corpus make_corpus) {
+    using uni::property;
+    const auto text = make_corpus(1 << 16);
+    for(auto _ : state) {
+        for(char32_t c : text) {
+            const auto props = uni::cp_properties(c);
+            benchmark::DoNotOptimize(props.contains(property::xids));
+            benchmark::DoNotOptimize(props.contains(property::xidc));
+            benchmark::DoNotOptimize(props.contains(property::wspace));
+            benchmark::DoNotOptimize(props.contains(property::pat_syn));
+            benchmark::DoNotOptimize(props.contains(property::emoji));
+        }
+    }
+    state.SetItemsProcessed(std::int64_t(state.iterations()) * std::int64_t(text.size()));
+}
+
+BENCHMARK_CAPTURE(bench_cp_property_is, ascii, corpus::ascii);
+BENCHMARK_CAPTURE(bench_cp_property_is, cjk, corpus::cjk);
+BENCHMARK_CAPTURE(bench_cp_property_is, mixed, corpus::mixed);
+
+BENCHMARK_CAPTURE(bench_cp_properties, ascii, corpus::ascii);
+BENCHMARK_CAPTURE(bench_cp_properties, cjk, corpus::cjk);
+BENCHMARK_CAPTURE(bench_cp_properties, mixed, corpus::mixed);
+
+BENCHMARK_MAIN();
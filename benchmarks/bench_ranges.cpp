@@ -0,0 +1,141 @@
+#include "corpus.h"
+#include <benchmark/benchmark.h>
+#include <cedilla/properties.hpp>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+// The range_layout searches over the compact_range tables, whichever layout the header was
+// generated with
+
+namespace {
+
+using uni::detail::range_layout;
+
+template<typename T, auto N, range_layout layout>
+std::vector<std::uint32_t> sorted_entries(const uni::detail::compact_range<T, N, layout>& table) {
+    // entries are unique, the other layouts only add copies of the last one
+    std::vector<std::uint32_t> sorted(std::begin(table._data), std::end(table._data));
+    std::sort(sorted.begin(), sorted.end());
+    sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+    return sorted;
+}
+
+// Same layouts as gen.py
+std::vector<std::uint32_t> eytzinger_entries(std::vector<std::uint32_t> sorted) {
+    std::size_t size = 1;
+    while(size < sorted.size() + 1)
+        size *= 2;
+    sorted.resize(size - 1, sorted.back());
+    std::vector<std::uint32_t> tree(size, sorted.back());
+    auto it = sorted.begin();
+    auto fill = [&](auto& self, std::size_t k) -> void {
+        if(k >= size)
+            return;
+        self(self, 2 * k);
+        tree[k] = *it++;
+        self(self, 2 * k + 1);
+    };
+    fill(fill, 1);
+    return tree;
+}
+
+std::vector<std::uint32_t> stree_entries(std::vector<std::uint32_t> sorted) {
+    constexpr std::size_t b = 16;
+    std::size_t size = b;
+    while(size < sorted.size())
+        size = size * (b + 1) + b;
+    sorted.resize(size, sorted.back());
+    std::vector<std::uint32_t> tree(size);
+    auto it = sorted.begin();
+    auto fill = [&](auto& self, std::size_t k) -> void {
+        if(k * b >= size)
+            return;
+        for(std::size_t i = 0; i <= b; i++) {
+            self(self, k * (b + 1) + i + 1);
+            if(i < b)
+                tree[k * b + i] = *it++;
+        }
+    };
+    fill(fill, 0);
+    tree.push_back(sorted.back());
+    return tree;
+}
+
+std::u32string sequential_access() {
+    std::u32string s;
+    for(char32_t c = 0; c <= 0x10FFFF; c++)
+        s.push_back(c);
+    return s;
+}
+
+std::u32string random_access() {
+    corpus::rng r;
+    std::u32string s;
+    for(char32_t c = 0; c <= 0x10FFFF; c++)
+        s.push_back(char32_t(r() % 0x110000));
+    return s;
+}
+
+const std::vector<std::uint32_t> age_sorted = sorted_entries(uni::detail::tables::age_data);
+const std::vector<std::uint32_t> age_eytzinger = eytzinger_entries(age_sorted);
+const std::vector<std::uint32_t> age_stree = stree_entries(age_sorted);
+const std::vector<std::uint32_t> script_sorted = sorted_entries(uni::detail::tables::script_data);
+const std::vector<std::uint32_t> script_eytzinger = eytzinger_entries(script_sorted);
+const std::vector<std::uint32_t> script_stree = stree_entries(script_sorted);
+
+}    // namespace
+
+template<typename Corpus>
+static void bench_sorted(benchmark::State& state, const std::vector<std::uint32_t>* table,
+                         Corpus make_corpus) {
+    const auto text = make_corpus();
+    for(auto _ : state) {
+        for(char32_t c : text) {
+            benchmark::DoNotOptimize(uni::detail::sorted_range_index(table->data(), table->size(), c));
+        }
+    }
+    state.SetItemsProcessed(std::int64_t(state.iterations()) * std::int64_t(text.size()));
+}
+
+template<typename Corpus>
+static void bench_eytzinger(benchmark::State& state, const std::vector<std::uint32_t>* table,
+                            Corpus make_corpus) {
+    const auto text = make_corpus();
+    for(auto _ : state) {
+        for(char32_t c : text) {
+            benchmark::DoNotOptimize(uni::detail::eytzinger_range_index(table->data(), table->size(), c));
+        }
+    }
+    state.SetItemsProcessed(std::int64_t(state.iterations()) * std::int64_t(text.size()));
+}
+
+template<typename Corpus>
+static void bench_stree(benchmark::State& state, const std::vector<std::uint32_t>* table,
+                        Corpus make_corpus) {
+    const auto text = make_corpus();
+    for(auto _ : state) {
+        for(char32_t c : text) {
+            benchmark::DoNotOptimize(uni::detail::stree_range_index(table->data(), table->size(), c));
+        }
+    }
+    state.SetItemsProcessed(std::int64_t(state.iterations()) * std::int64_t(text.size()));
+}
+
+BENCHMARK_CAPTURE(bench_sorted, age_sequential, &age_sorted, sequential_access);
+BENCHMARK_CAPTURE(bench_eytzinger, age_sequential, &age_eytzinger, sequential_access);
+BENCHMARK_CAPTURE(bench_stree, age_sequential, &age_stree, sequential_access);
+
+BENCHMARK_CAPTURE(bench_sorted, age_random, &age_sorted, random_access);
+BENCHMARK_CAPTURE(bench_eytzinger, age_random, &age_eytzinger, random_access);
+BENCHMARK_CAPTURE(bench_stree, age_random, &age_stree, random_access);
+
+BENCHMARK_CAPTURE(bench_sorted, script_sequential, &script_sorted, sequential_access);
+BENCHMARK_CAPTURE(bench_eytzinger, script_sequential, &script_eytzinger, sequential_access);
+BENCHMARK_CAPTURE(bench_stree, script_sequential, &script_stree, sequential_access);
+
+BENCHMARK_CAPTURE(bench_sorted, script_random, &script_sorted, random_access);
+BENCHMARK_CAPTURE(bench_eytzinger, script_random, &script_eytzinger, random_access);
+BENCHMARK_CAPTURE(bench_stree, script_random, &script_stree, random_access);
+
+BENCHMARK_MAIN();
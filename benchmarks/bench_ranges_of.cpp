@@ -0,0 +1,75 @@
+#include <benchmark/benchmark.h>
+#include <cedilla/properties.hpp>
+
+// Enumerating the code points of a property with ranges_of against probing every code point
+
+using namespace uni;
+
+static void bench_alpha_probe(benchmark::State& state) {
+    for(auto _ : state) {
+        std::size_t count = 0;
+        for(char32_t c = 0; c <= 0x10FFFF; c++)
+            count += cp_property_is<property::alphabetic>(c);
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetItemsProcessed(std::int64_t(state.iterations()) * 0x110000);
+}
+
+static void bench_alpha_ranges_of(benchmark::State& state) {
+    for(auto _ : state) {
+        std::size_t count = 0;
+        for(const auto r : ranges_of(property::alphabetic))
+            count += r.last - r.first + 1;
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetItemsProcessed(std::int64_t(state.iterations()) * 0x110000);
+}
+
+static void bench_han_probe(benchmark::State& state) {
+    for(auto _ : state) {
+        std::size_t count = 0;
+        for(char32_t c = 0; c <= 0x10FFFF; c++)
+            count += cp_script(c) == script::hani;
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetItemsProcessed(std::int64_t(state.iterations()) * 0x110000);
+}
+
+static void bench_han_ranges_of(benchmark::State& state) {
+    for(auto _ : state) {
+        std::size_t count = 0;
+        for(const auto r : ranges_of(script::hani))
+            count += r.last - r.first + 1;
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetItemsProcessed(std::int64_t(state.iterations()) * 0x110000);
+}
+
+static void bench_letter_probe(benchmark::State& state) {
+    for(auto _ : state) {
+        std::size_t count = 0;
+        for(char32_t c = 0; c <= 0x10FFFF; c++)
+            count += cp_category_is<category::letter>(c);
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetItemsProcessed(std::int64_t(state.iterations()) * 0x110000);
+}
+
+static void bench_letter_ranges_of(benchmark::State& state) {
+    for(auto _ : state) {
+        std::size_t count = 0;
+        for(const auto r : ranges_of(category::letter))
+            count += r.last - r.first + 1;
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetItemsProcessed(std::int64_t(state.iterations()) * 0x110000);
+}
+
+BENCHMARK(bench_alpha_probe);
+BENCHMARK(bench_alpha_ranges_of);
+BENCHMARK(bench_han_probe);
+BENCHMARK(bench_han_ranges_of);
+BENCHMARK(bench_letter_probe);
+BENCHMARK(bench_letter_ranges_of);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,98 @@
+#include "corpus.h"
+#include <benchmark/benchmark.h>
+#include <cedilla/properties.hpp>
+
+// Splitting text into runs of the same script or category: one lookup per code point, against one
+// run query per run, the code points of which are then compared to its bounds.
+// And walks of all the code points, one lookup per code point against one query per run.
+
+using namespace uni;
+
+namespace {
+
+const auto script_of = [](char32_t c) { return cp_script(c); };
+const auto script_run_of = [](char32_t c) { return cp_script_run(c); };
+const auto category_of = [](char32_t c) { return cp_category(c); };
+const auto category_run_of = [](char32_t c) { return cp_category_run(c); };
+const auto alpha_of = [](char32_t c) { return cp_property_is(property::alphabetic, c); };
+const auto alpha_run_of = [](char32_t c) { return cp_property_run(property::alphabetic, c); };
+
+}    // namespace
+
+template<typename F, typename Corpus>
+static void bench_itemize(benchmark::State& state, F f, Corpus make_corpus) {
+    const auto text = make_corpus(1 << 16);
+    for(auto _ : state) {
+        std::size_t runs = 1;
+        auto value = f(text[0]);
+        for(char32_t c : text) {
+            const auto v = f(c);
+            runs += v != value;
+            value = v;
+        }
+        benchmark::DoNotOptimize(runs);
+    }
+    state.SetItemsProcessed(std::int64_t(state.iterations()) * std::int64_t(text.size()));
+}
+
+template<typename F, typename Corpus>
+static void bench_itemize_runs(benchmark::State& state, F f, Corpus make_corpus) {
+    const auto text = make_corpus(1 << 16);
+    for(auto _ : state) {
+        std::size_t runs = 1;
+        auto run = f(text[0]);
+        for(char32_t c : text) {
+            if(c >= run.first && c <= run.last)
+                continue;
+            const auto next = f(c);
+            runs += next.value != run.value;
+            run = next;
+        }
+        benchmark::DoNotOptimize(runs);
+    }
+    state.SetItemsProcessed(std::int64_t(state.iterations()) * std::int64_t(text.size()));
+}
+
+template<typename F>
+static void bench_walk(benchmark::State& state, F f) {
+    for(auto _ : state) {
+        std::size_t changes = 0;
+        auto value = f(0);
+        for(char32_t c = 0; c <= 0x10FFFF; c++) {
+            const auto v = f(c);
+            changes += v != value;
+            value = v;
+        }
+        benchmark::DoNotOptimize(changes);
+    }
+    state.SetItemsProcessed(std::int64_t(state.iterations()) * 0x110000);
+}
+
+template<typename F>
+static void bench_walk_runs(benchmark::State& state, F f) {
+    for(auto _ : state) {
+        std::size_t runs = 0;
+        for(char32_t c = 0; c <= 0x10FFFF; c = f(c).last + 1)
+            runs++;
+        benchmark::DoNotOptimize(runs);
+    }
+    state.SetItemsProcessed(std::int64_t(state.iterations()) * 0x110000);
+}
+
+BENCHMARK_CAPTURE(bench_itemize, script_cyrillic, script_of, corpus::cyrillic);
+BENCHMARK_CAPTURE(bench_itemize, script_cjk, script_of, corpus::cjk);
+BENCHMARK_CAPTURE(bench_itemize_runs, script_cyrillic, script_run_of, corpus::cyrillic);
+BENCHMARK_CAPTURE(bench_itemize_runs, script_cjk, script_run_of, corpus::cjk);
+BENCHMARK_CAPTURE(bench_itemize, category_cyrillic, category_of, corpus::cyrillic);
+BENCHMARK_CAPTURE(bench_itemize, category_cjk, category_of, corpus::cjk);
+BENCHMARK_CAPTURE(bench_itemize_runs, category_cyrillic, category_run_of, corpus::cyrillic);
+BENCHMARK_CAPTURE(bench_itemize_runs, category_cjk, category_run_of, corpus::cjk);
+
+BENCHMARK_CAPTURE(bench_walk, script, script_of)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(bench_walk_runs, script, script_run_of)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(bench_walk, category, category_of)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(bench_walk_runs, category, category_run_of)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(bench_walk, alphabetic, alpha_of)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(bench_walk_runs, alphabetic, alpha_run_of)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,74 @@
+#include "corpus.h"
+#include <benchmark/benchmark.h>
+#include <cedilla/properties.hpp>
+#include <memory>
+#include <vector>
+
+// Character class rules loaded at runtime, against the same rules known at compile time
+
+using uni::detail::binary_prop;
+
+static std::vector<binary_prop> rules() {
+    std::vector<binary_prop> r;
+    for(const char* name : {"XID_Start", "White_Space", "Lu", "Greek", "scx=Arabic"})
+        r.push_back(uni::detail::binary_prop_from_string(name));
+    return r;
+}
+
+template<typename Corpus>
+static void bench_rules_static(benchmark::State& state, Corpus make_corpus) {
+    using uni::detail::get_binary_prop;
+    const auto text = make_corpus(1 << 16);
+    for(auto _ : state) {
+        for(char32_t c : text) {
+            benchmark::DoNotOptimize(get_binary_prop<binary_prop::xids>(c));
+            benchmark::DoNotOptimize(get_binary_prop<binary_prop::wspace>(c));
+            benchmark::DoNotOptimize(get_binary_prop<binary_prop::lu>(c));
+            benchmark::DoNotOptimize(get_binary_prop<binary_prop::grek>(c));
+            benchmark::DoNotOptimize(get_binary_prop<binary_prop::scx_arab>(c));
+        }
+    }
+    state.SetItemsProcessed(std::int64_t(state.iterations()) * std::int64_t(text.size()));
+}
+
+template<typename Corpus>
+static void bench_rules_runtime(benchmark::State& state, Corpus make_corpus) {
+    const auto text = make_corpus(1 << 16);
+    const auto r = rules();
+    for(auto _ : state) {
+        for(char32_t c : text) {
+            for(auto p : r)
+                benchmark::DoNotOptimize(uni::detail::cp_has_binary_prop(p, c));
+        }
+    }
+    state.SetItemsProcessed(std::int64_t(state.iterations()) * std::int64_t(text.size()));
+}
+
+template<typename Corpus>
+static void bench_rules_runtime_batch(benchmark::State& state, Corpus make_corpus) {
+    const auto text = make_corpus(1 << 16);
+    const auto r = rules();
+    std::unique_ptr<bool[]> out(new bool[text.size()]);
+    for(auto _ : state) {
+        for(auto p : r) {
+            uni::detail::cp_has_binary_prop(p, text.data(), text.data() + text.size(), out.get());
+            benchmark::DoNotOptimize(out.get());
+            benchmark::ClobberMemory();
+        }
+    }
+    state.SetItemsProcessed(std::int64_t(state.iterations()) * std::int64_t(text.size()));
+}
+
+BENCHMARK_CAPTURE(bench_rules_static, ascii, corpus::ascii);
+BENCHMARK_CAPTURE(bench_rules_static, cjk, corpus::cjk);
+BENCHMARK_CAPTURE(bench_rules_static, mixed, corpus::mixed);
+
+BENCHMARK_CAPTURE(bench_rules_runtime, ascii, corpus::ascii);
+BENCHMARK_CAPTURE(bench_rules_runtime, cjk, corpus::cjk);
+BENCHMARK_CAPTURE(bench_rules_runtime, mixed, corpus::mixed);
+
+BENCHMARK_CAPTURE(bench_rules_runtime_batch, ascii, corpus::ascii);
+BENCHMARK_CAPTURE(bench_rules_runtime_batch, cjk, corpus::cjk);
+BENCHMARK_CAPTURE(bench_rules_runtime_batch, mixed, corpus::mixed);
+
+BENCHMARK_MAIN();
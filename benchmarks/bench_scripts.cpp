@@ -0,0 +1,51 @@
+#include "corpus.h"
+#include <benchmark/benchmark.h>
+#include <cedilla/properties.hpp>
+
+template<typename Corpus>
+static void bench_script(benchmark::State& state, Corpus make_corpus) {
+    const auto text = make_corpus(1 << 16);
+    for(auto _ : state) {
+        for(char32_t c : text) {
+            benchmark::DoNotOptimize(uni::cp_script(c));
+        }
+    }
+    state.SetItemsProcessed(std::int64_t(state.iterations()) * std::int64_t(text.size()));
+}
+
+template<typename Corpus>
+static void bench_script_extensions_iterate(benchmark::State& state, Corpus make_corpus) {
+    const auto text = make_corpus(1 << 16);
+    for(auto _ : state) {
+        for(char32_t c : text) {
+            for(auto s : uni::cp_script_extensions(c))
+                benchmark::DoNotOptimize(s);
+        }
+    }
+    state.SetItemsProcessed(std::int64_t(state.iterations()) * std::int64_t(text.size()));
+}
+
+template<typename Corpus>
+static void bench_script_extensions_contains(benchmark::State& state, Corpus make_corpus) {
+    const auto text = make_corpus(1 << 16);
+    for(auto _ : state) {
+        for(char32_t c : text) {
+            benchmark::DoNotOptimize(uni::cp_script_extensions(c).contains(uni::script::latin));
+        }
+    }
+    state.SetItemsProcessed(std::int64_t(state.iterations()) * std::int64_t(text.size()));
+}
+
+BENCHMARK_CAPTURE(bench_script, ascii, corpus::ascii);
+BENCHMARK_CAPTURE(bench_script, cjk, corpus::cjk);
+BENCHMARK_CAPTURE(bench_script, mixed, corpus::mixed);
+
+BENCHMARK_CAPTURE(bench_script_extensions_iterate, ascii, corpus::ascii);
+BENCHMARK_CAPTURE(bench_script_extensions_iterate, cjk, corpus::cjk);
+BENCHMARK_CAPTURE(bench_script_extensions_iterate, mixed, corpus::mixed);
+
+BENCHMARK_CAPTURE(bench_script_extensions_contains, ascii, corpus::ascii);
+BENCHMARK_CAPTURE(bench_script_extensions_contains, cjk, corpus::cjk);
+BENCHMARK_CAPTURE(bench_script_extensions_contains, mixed, corpus::mixed);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,94 @@
+#include <benchmark/benchmark.h>
+#include <cedilla/properties.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+// Searches of the sorted arrays backing flat_array, range_array and compact_range, at the sizes of
+// the tables gen.py emits (the summary at the end of the generated header): a few entries for the
+// smallest flat_arrays, up to 2345 for the script compact_range.
+// The scalar searches, which constant evaluations keep using, against the vectorized ones.
+
+using namespace uni::detail;
+
+namespace {
+
+// size sorted range entries spread over the code space, with random values
+std::vector<std::uint32_t> make_ranges(std::size_t size) {
+    std::mt19937 gen(42);
+    std::vector<std::uint32_t> starts(size);
+    std::uniform_int_distribution<std::uint32_t> cp(0, 0x10FFFF);
+    for(auto& s : starts)
+        s = cp(gen);
+    std::sort(starts.begin(), starts.end());
+    starts.erase(std::unique(starts.begin(), starts.end()), starts.end());
+    std::vector<std::uint32_t> entries;
+    for(auto s : starts)
+        entries.push_back((s << 8) | (gen() & 0xFF));
+    return entries;
+}
+
+// Code points to look up: a quarter of them start an entry, the rest are random
+std::vector<char32_t> make_keys(const std::vector<std::uint32_t>& entries) {
+    std::mt19937 gen(7);
+    std::uniform_int_distribution<std::uint32_t> cp(0, 0x10FFFF);
+    std::vector<char32_t> keys(1 << 12);
+    for(std::size_t i = 0; i < keys.size(); i++)
+        keys[i] = i % 4 == 0 ? char32_t(entries[gen() % entries.size()] >> 8) : char32_t(cp(gen));
+    return keys;
+}
+
+}    // namespace
+
+template<typename Search>
+static void bench_range_index(benchmark::State& state, Search search) {
+    const auto entries = make_ranges(std::size_t(state.range(0)));
+    const auto keys = make_keys(entries);
+    for(auto _ : state) {
+        std::size_t found = 0;
+        for(char32_t c : keys)
+            found += search(entries.data(), entries.size(), c);
+        benchmark::DoNotOptimize(found);
+    }
+    state.SetItemsProcessed(std::int64_t(state.iterations()) * std::int64_t(keys.size()));
+}
+
+template<typename Search>
+static void bench_membership(benchmark::State& state, Search search) {
+    auto entries = make_ranges(std::size_t(state.range(0)));
+    for(auto& e : entries)
+        e >>= 8;
+    const auto keys = make_keys(make_ranges(std::size_t(state.range(0))));
+    for(auto _ : state) {
+        std::size_t found = 0;
+        for(char32_t c : keys)
+            found += search(entries.data(), entries.size(), c);
+        benchmark::DoNotOptimize(found);
+    }
+    state.SetItemsProcessed(std::int64_t(state.iterations()) * std::int64_t(keys.size()));
+}
+
+static void sizes(benchmark::internal::Benchmark* b) {
+    for(auto n : {7, 13, 21, 39, 50, 152, 311, 707, 1639, 2345})
+        b->Arg(n);
+}
+
+BENCHMARK_CAPTURE(bench_range_index, scalar, scalar_sorted_range_index)->Apply(sizes);
+#if defined(CEDILLA_SIMD_SEARCH)
+BENCHMARK_CAPTURE(bench_range_index, simd, simd_sorted_range_index)->Apply(sizes);
+#endif
+
+BENCHMARK_CAPTURE(bench_membership, linear,
+                  [](const std::uint32_t* data, std::size_t n, char32_t c) { return std::find(data, data + n, c) != data + n; })
+    ->Apply(sizes);
+BENCHMARK_CAPTURE(bench_membership, binary_search,
+                  [](const std::uint32_t* data, std::size_t n, char32_t c) { return binary_search(data, data + n, std::uint32_t(c)); })
+    ->Apply(sizes);
+#if defined(CEDILLA_SIMD_SEARCH)
+BENCHMARK_CAPTURE(bench_membership, simd,
+                  [](const std::uint32_t* data, std::size_t n, char32_t c) { return simd_contains(data, n, std::uint32_t(c)); })
+    ->Apply(sizes);
+#endif
+
+BENCHMARK_MAIN();
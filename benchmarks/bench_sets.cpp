@@ -0,0 +1,72 @@
+#include "corpus.h"
+#include <benchmark/benchmark.h>
+#include <cedilla/properties.hpp>
+
+// Composite sets folded at compile time against the equivalent chains of calls
+
+using namespace uni;
+
+template<typename Corpus>
+static void bench_alpha_not_latin_chain(benchmark::State& state, Corpus make_corpus) {
+    const auto text = make_corpus(1 << 16);
+    for(auto _ : state) {
+        for(char32_t c : text) {
+            benchmark::DoNotOptimize(cp_property_is<property::alphabetic>(c) && cp_script(c) != script::latn);
+        }
+    }
+    state.SetItemsProcessed(std::int64_t(state.iterations()) * std::int64_t(text.size()));
+}
+
+template<typename Corpus>
+static void bench_alpha_not_latin_set(benchmark::State& state, Corpus make_corpus) {
+    constexpr auto set = set_of<property::alphabetic>() - set_of<script::latn>();
+    const auto text = make_corpus(1 << 16);
+    for(auto _ : state) {
+        for(char32_t c : text) {
+            benchmark::DoNotOptimize(set.contains(c));
+        }
+    }
+    state.SetItemsProcessed(std::int64_t(state.iterations()) * std::int64_t(text.size()));
+}
+
+template<typename Corpus>
+static void bench_word_chain(benchmark::State& state, Corpus make_corpus) {
+    const auto text = make_corpus(1 << 16);
+    for(auto _ : state) {
+        for(char32_t c : text) {
+            benchmark::DoNotOptimize(cp_category_is<category::lu>(c) || cp_category_is<category::lt>(c) ||
+                                     cp_category_is<category::nd>(c) || cp_category_is<category::pc>(c));
+        }
+    }
+    state.SetItemsProcessed(std::int64_t(state.iterations()) * std::int64_t(text.size()));
+}
+
+template<typename Corpus>
+static void bench_word_set(benchmark::State& state, Corpus make_corpus) {
+    constexpr auto set = set_of<category::lu>() | set_of<category::lt>() | set_of<category::nd>() | set_of<category::pc>();
+    const auto text = make_corpus(1 << 16);
+    for(auto _ : state) {
+        for(char32_t c : text) {
+            benchmark::DoNotOptimize(set.contains(c));
+        }
+    }
+    state.SetItemsProcessed(std::int64_t(state.iterations()) * std::int64_t(text.size()));
+}
+
+BENCHMARK_CAPTURE(bench_alpha_not_latin_chain, ascii, corpus::ascii);
+BENCHMARK_CAPTURE(bench_alpha_not_latin_chain, cjk, corpus::cjk);
+BENCHMARK_CAPTURE(bench_alpha_not_latin_chain, mixed, corpus::mixed);
+
+BENCHMARK_CAPTURE(bench_alpha_not_latin_set, ascii, corpus::ascii);
+BENCHMARK_CAPTURE(bench_alpha_not_latin_set, cjk, corpus::cjk);
+BENCHMARK_CAPTURE(bench_alpha_not_latin_set, mixed, corpus::mixed);
+
+BENCHMARK_CAPTURE(bench_word_chain, ascii, corpus::ascii);
+BENCHMARK_CAPTURE(bench_word_chain, cjk, corpus::cjk);
+BENCHMARK_CAPTURE(bench_word_chain, mixed, corpus::mixed);
+
+BENCHMARK_CAPTURE(bench_word_set, ascii, corpus::ascii);
+BENCHMARK_CAPTURE(bench_word_set, cjk, corpus::cjk);
+BENCHMARK_CAPTURE(bench_word_set, mixed, corpus::mixed);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,122 @@
+#include "corpus.h"
+#include <benchmark/benchmark.h>
+#include <cedilla/properties.hpp>
+
+// Classifying UTF-8 text directly against decoding every sequence first
+
+using namespace uni;
+
+namespace {
+
+// A validating decoder, as callers without UTF-8 lookups use
+std::size_t decode(const unsigned char* s, std::size_t len, char32_t& c) {
+    const unsigned b0 = s[0];
+    if(b0 < 0x80) {
+        c = b0;
+        return 1;
+    }
+    std::size_t n = b0 >= 0xF0 ? 4 : b0 >= 0xE0 ? 3 : 2;
+    if(b0 < 0xC2 || b0 > 0xF4 || n > len) {
+        c = 0xFFFD;
+        return 1;
+    }
+    c = b0 & (0x7F >> n);
+    for(std::size_t i = 1; i < n; i++) {
+        if((s[i] & 0xC0) != 0x80) {
+            c = 0xFFFD;
+            return i;
+        }
+        c = (c << 6) | (s[i] & 0x3F);
+    }
+    return n;
+}
+
+// Length of the sequence to skip, branches on ASCII like decode does
+std::size_t next(unsigned char b) {
+    if(b < 0x80)
+        return 1;
+    const std::size_t n = detail::utf8_sequence_length(b);
+    return n == 0 ? 1 : n;
+}
+
+}    // namespace
+
+template<typename Corpus>
+static void bench_alpha_decode(benchmark::State& state, Corpus make_corpus) {
+    const auto text = corpus::to_utf8(make_corpus(1 << 16));
+    const auto* first = reinterpret_cast<const unsigned char*>(text.data());
+    for(auto _ : state) {
+        std::size_t count = 0;
+        for(std::size_t i = 0; i < text.size();) {
+            char32_t c = 0;
+            i += decode(first + i, text.size() - i, c);
+            count += cp_property_is<property::alphabetic>(c);
+        }
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetBytesProcessed(std::int64_t(state.iterations()) * std::int64_t(text.size()));
+}
+
+template<typename Corpus>
+static void bench_alpha_utf8(benchmark::State& state, Corpus make_corpus) {
+    const auto text = corpus::to_utf8(make_corpus(1 << 16));
+    const auto* first = reinterpret_cast<const unsigned char*>(text.data());
+    for(auto _ : state) {
+        std::size_t count = 0;
+        for(std::size_t i = 0; i < text.size();) {
+            count += cp_property_is_utf8<property::alphabetic>(first + i, text.size() - i);
+            i += next(first[i]);
+        }
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetBytesProcessed(std::int64_t(state.iterations()) * std::int64_t(text.size()));
+}
+
+template<typename Corpus>
+static void bench_assigned_trie_decode(benchmark::State& state, Corpus make_corpus) {
+    const auto text = corpus::to_utf8(make_corpus(1 << 16));
+    const auto* first = reinterpret_cast<const unsigned char*>(text.data());
+    for(auto _ : state) {
+        std::size_t count = 0;
+        for(std::size_t i = 0; i < text.size();) {
+            char32_t c = 0;
+            i += decode(first + i, text.size() - i, c);
+            count += detail::tables::prop_assigned.lookup(c);
+        }
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetBytesProcessed(std::int64_t(state.iterations()) * std::int64_t(text.size()));
+}
+
+template<typename Corpus>
+static void bench_assigned_trie_utf8(benchmark::State& state, Corpus make_corpus) {
+    const auto text = corpus::to_utf8(make_corpus(1 << 16));
+    const auto* first = reinterpret_cast<const unsigned char*>(text.data());
+    for(auto _ : state) {
+        std::size_t count = 0;
+        for(std::size_t i = 0; i < text.size();) {
+            count += detail::tables::prop_assigned.lookup_utf8(first + i, text.size() - i);
+            i += next(first[i]);
+        }
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetBytesProcessed(std::int64_t(state.iterations()) * std::int64_t(text.size()));
+}
+
+BENCHMARK_CAPTURE(bench_alpha_decode, ascii, corpus::ascii);
+BENCHMARK_CAPTURE(bench_alpha_decode, cjk, corpus::cjk);
+BENCHMARK_CAPTURE(bench_alpha_decode, mixed, corpus::mixed);
+
+BENCHMARK_CAPTURE(bench_alpha_utf8, ascii, corpus::ascii);
+BENCHMARK_CAPTURE(bench_alpha_utf8, cjk, corpus::cjk);
+BENCHMARK_CAPTURE(bench_alpha_utf8, mixed, corpus::mixed);
+
+BENCHMARK_CAPTURE(bench_assigned_trie_decode, ascii, corpus::ascii);
+BENCHMARK_CAPTURE(bench_assigned_trie_decode, cjk, corpus::cjk);
+BENCHMARK_CAPTURE(bench_assigned_trie_decode, mixed, corpus::mixed);
+
+BENCHMARK_CAPTURE(bench_assigned_trie_utf8, ascii, corpus::ascii);
+BENCHMARK_CAPTURE(bench_assigned_trie_utf8, cjk, corpus::cjk);
+BENCHMARK_CAPTURE(bench_assigned_trie_utf8, mixed, corpus::mixed);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <utility>
+
+// Deterministic synthetic corpora used by the benchmarks.
+// They approximate the distribution of code points of real text without
+// requiring any data file.
+namespace corpus {
+
+struct rng {
+    std::uint64_t state = 0x853c49e6748fea9bULL;
+    std::uint32_t operator()() {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        return static_cast<std::uint32_t>(state >> 33);
+    }
+};
+
+using range = std::pair<char32_t, char32_t>;
+
+template<std::size_t N>
+std::u32string from_ranges(std::size_t size, const std::array<range, N>& ranges) {
+    rng r;
+    std::u32string s;
+    s.reserve(size);
+    while(s.size() < size) {
+        const auto& [first, last] = ranges[r() % N];
+        s.push_back(char32_t(first + r() % (last - first + 1)));
+    }
+    return s;
+}
+
+inline std::u32string ascii(std::size_t size = 1 << 16) {
+    return from_ranges<4>(size, {range{'a', 'z'}, range{'a', 'z'}, range{'A', 'Z'}, range{' ', '@'}});
+}
+
+inline std::u32string cjk(std::size_t size = 1 << 16) {
+    return from_ranges<4>(size, {range{0x4E00, 0x9FFF}, range{0x4E00, 0x9FFF},
+                                 range{0x3040, 0x30FF}, range{0x3000, 0x303F}});
+}
+
+inline std::u32string mixed(std::size_t size = 1 << 16) {
+    return from_ranges<10>(size, {range{'a', 'z'}, range{' ', '@'}, range{0xC0, 0x24F},
+                                  range{0x370, 0x3FF}, range{0x400, 0x4FF}, range{0x600, 0x6FF},
+                                  range{0x900, 0x97F}, range{0x4E00, 0x9FFF},
+                                  range{0xAC00, 0xD7A3}, range{0x1F300, 0x1FAFF}});
+}
+
+// Code points drawn from the whole code space but for Latin-1, so that lookups touch all the
+// tables instead of the few cache lines of one script
+inline std::u32string shuffled(std::size_t size = 1 << 20) {
+    return from_ranges<4>(size, {range{0x800, 0xFFFF}, range{0x10000, 0x1FFFF},
+                                 range{0x20000, 0x3134F}, range{0xE0000, 0xE01EF}});
+}
+
+// Words of 2 to 9 Cyrillic letters separated by spaces, as in monolingual text
+inline std::u32string cyrillic(std::size_t size = 1 << 16) {
+    rng r;
+    std::u32string s;
+    s.reserve(size);
+    while(s.size() < size) {
+        for(std::uint32_t n = 2 + r() % 8; n != 0 && s.size() < size; n--)
+            s.push_back(char32_t(0x430 + r() % 32));
+        s.push_back(U' ');
+    }
+    s.resize(size);
+    return s;
+}
+
+inline std::string to_utf8(const std::u32string& text) {
+    std::string s;
+    for(char32_t c : text) {
+        if(c < 0x80) {
+            s.push_back(char(c));
+        } else if(c < 0x800) {
+            s.push_back(char(0xC0 | (c >> 6)));
+            s.push_back(char(0x80 | (c & 0x3F)));
+        } else if(c < 0x10000) {
+            s.push_back(char(0xE0 | (c >> 12)));
+            s.push_back(char(0x80 | ((c >> 6) & 0x3F)));
+            s.push_back(char(0x80 | (c & 0x3F)));
+        } else {
+            s.push_back(char(0xF0 | (c >> 18)));
+            s.push_back(char(0x80 | ((c >> 12) & 0x3F)));
+            s.push_back(char(0x80 | ((c >> 6) & 0x3F)));
+            s.push_back(char(0x80 | (c & 0x3F)));
+        }
+    }
+    return s;
+}
+
+}    // namespace corpus
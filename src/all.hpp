@@ -3,5 +3,9 @@
 #include "cedilla/base.h"
 #include "cedilla/generated_props.hpp"
 #include "cedilla/unicode.h"
+#include "cedilla/ranges.h"
+#include "cedilla/sets.h"
+#include "cedilla/batch.h"
+#include "cedilla/cursor.h"
 #include "cedilla/regex.h"
 
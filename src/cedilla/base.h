@@ -2,6 +2,20 @@
 #include <cstdint>
 #include <algorithm>
 #include <string_view>
+#include <type_traits>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// Storage of the tables read by the lookups of typical text, see HOT_TABLES in gen.py.
+// On ELF targets they get a section of their own, which keeps them on the same pages.
+#if defined(__GNUC__) && defined(__ELF__)
+#define CEDILLA_HOT_TABLE alignas(64) [[gnu::section(".rodata.cedilla.hot")]]
+#else
+#define CEDILLA_HOT_TABLE alignas(64)
+#endif
 
 namespace uni::detail {
 
@@ -67,19 +81,366 @@ constexpr bool binary_search(ForwardIt first, ForwardIt last, const T& value) {
     first = detail::lower_bound(first, last, value);
     return (!(first == last) && !(value < *first));
 }
-template<typename T, auto N>
+enum class range_layout { sorted, eytzinger, stree };
+
+// Layout of the stage arrays of a bool_trie.
+// trimmed drops their leading and trailing zero entries, which lookups check for,
+// padded keeps them so that lookups can be free of branches.
+enum class trie_layout { trimmed, padded };
+
+constexpr unsigned countr_zero(std::uint64_t v) {
+#if defined(__GNUC__)
+    return static_cast<unsigned>(__builtin_ctzll(v));
+#else
+    unsigned n = 0;
+    for(; (v & 1) == 0; v >>= 1)
+        n++;
+    return n;
+#endif
+}
+
+constexpr unsigned popcount(std::uint32_t v) {
+#if defined(__GNUC__)
+    return static_cast<unsigned>(__builtin_popcount(v));
+#else
+    unsigned n = 0;
+    for(; v != 0; v &= v - 1)
+        n++;
+    return n;
+#endif
+}
+
+constexpr bool is_constant_evaluated() {
+#if defined(__GNUC__)
+    return __builtin_is_constant_evaluated();
+#else
+    return true;
+#endif
+}
+
+// Searches of sorted arrays comparing whole cache lines at once, where the target has SSE2 or AVX2.
+// The constant evaluations, and the other targets, use the scalar searches.
+#if defined(__AVX2__) || defined(__SSE2__)
+#define CEDILLA_SIMD_SEARCH
+
+// Entries compared by the vectorized scans, a binary search narrows larger arrays down to that
+constexpr std::size_t simd_scan_size = 64;
+
+// Number of the entries of [data, data + n) at or below key.
+// n is at most simd_scan_size, the entries are compared 8 at a time, the tail one by one.
+// T is std::uint32_t or char32_t, which flat_array holds.
+template<typename T>
+std::size_t simd_count_not_greater_scan(const T* data, std::size_t n, T key) {
+    std::size_t count = 0;
+    std::size_t i = 0;
+#if defined(__AVX2__)
+    const __m256i k = _mm256_set1_epi32(static_cast<int>(key));
+    for(; i + 8 <= n; i += 8) {
+        const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        const __m256i le = _mm256_cmpeq_epi32(_mm256_min_epu32(v, k), v);
+        count += popcount(static_cast<std::uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(le))));
+    }
+#else
+    // SSE2 compares signed integers, flip the sign bits to compare unsigned ones.
+    // The comparisons yield -1 in the lanes of the entries above key, which greater accumulates.
+    const __m128i bias = _mm_set1_epi32(static_cast<int>(0x80000000));
+    const __m128i k = _mm_xor_si128(_mm_set1_epi32(static_cast<int>(key)), bias);
+    __m128i greater = _mm_setzero_si128();
+    for(; i + 8 <= n; i += 8) {
+        const __m128i a = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i)), bias);
+        const __m128i b = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + 4)), bias);
+        greater = _mm_add_epi32(greater, _mm_add_epi32(_mm_cmpgt_epi32(a, k), _mm_cmpgt_epi32(b, k)));
+    }
+    greater = _mm_add_epi32(greater, _mm_shuffle_epi32(greater, 0x4E));
+    greater = _mm_add_epi32(greater, _mm_shuffle_epi32(greater, 0xB1));
+    count = i - static_cast<std::size_t>(-_mm_cvtsi128_si32(greater));
+#endif
+    for(; i < n; i++)
+        count += data[i] <= key;
+    return count;
+}
+
+// Number of the entries of the sorted array [data, data + n) at or below key
+template<typename T>
+std::size_t simd_count_not_greater(const T* data, std::size_t n, T key) {
+    std::size_t first = 0;
+    while(n > simd_scan_size) {
+        const std::size_t half = n / 2;
+        // the entries before first are all at or below key
+        if(data[first + half] <= key) {
+            first += half;
+            n -= half;
+        } else {
+            n = half;
+        }
+    }
+    return first + simd_count_not_greater_scan(data + first, n, key);
+}
+
+// Whether the sorted array [data, data + n) holds key
+template<typename T>
+bool simd_contains(const T* data, std::size_t n, T key) {
+    const std::size_t count = simd_count_not_greater(data, n, key);
+    return count != 0 && data[count - 1] == key;
+}
+#endif
+
+// compact_range and range_array entries hold the first code point of a range in their 24 high bits
+// and the value of that range in their 8 low bits.
+// A range ends where the next one begins, the last entry only marks the end of the last range.
+// Both searches return the index of the entry holding cp, or n if there is none.
+constexpr std::size_t scalar_sorted_range_index(const std::uint32_t* data, std::size_t n, char32_t cp) {
+    const auto it = detail::upper_bound(data, data + n, cp, [](char32_t local_cp, uint32_t v) {
+        char32_t c = (v >> 8);
+        return local_cp < c;
+    });
+    if(it == data + n || it == data)
+        return n;
+    return static_cast<std::size_t>(it - data) - 1;
+}
+
+#if defined(CEDILLA_SIMD_SEARCH)
+inline std::size_t simd_sorted_range_index(const std::uint32_t* data, std::size_t n, char32_t cp) {
+    // the entries starting at or before cp, with any value
+    const std::uint32_t key = cp > 0xFFFFFF ? 0xFFFFFFFF : (std::uint32_t(cp) << 8) | 0xFF;
+    const std::size_t count = simd_count_not_greater(data, n, key);
+    return count == 0 || count == n ? n : count - 1;
+}
+#endif
+
+constexpr std::size_t sorted_range_index(const std::uint32_t* data, std::size_t n, char32_t cp) {
+#if defined(CEDILLA_SIMD_SEARCH)
+    if(!is_constant_evaluated())
+        return simd_sorted_range_index(data, n, cp);
+#endif
+    return scalar_sorted_range_index(data, n, cp);
+}
+
+// Eytzinger layout: the entries form an implicit binary search tree, 1 being the root
+// and 2k, 2k + 1 the children of k. The tree is complete, padded with copies of the last entry,
+// which data[0] also holds.
+// The first levels are shared by all searches and stay in cache, and every search takes
+// the same number of steps, without branches.
+constexpr std::size_t eytzinger_range_index(const std::uint32_t* data, std::size_t n, char32_t cp) {
+    std::size_t k = 1;
+    while(k < n)
+        k = 2 * k + ((data[k] >> 8) <= cp);
+    // the entry is the last node after which the search went right
+    k >>= countr_zero(k) + 1;
+    return (k == 0 || (data[k] >> 8) >= (data[0] >> 8)) ? n : k;
+}
+
+// S-tree layout: a complete B-tree whose nodes hold 16 entries (a cache line), the children of
+// node k being the nodes 17k + 1 to 17k + 17. The tree is padded with copies of the last entry,
+// which is also stored after it.
+// A search reads one line per level, 3 for the largest tables.
+// Number of entries of a node starting at or before cp
+constexpr unsigned stree_node_rank(const std::uint32_t* node, char32_t cp) {
+    unsigned n = 0;
+    for(std::size_t j = 0; j < 16; j++)
+        n += (node[j] >> 8) <= cp;
+    return n;
+}
+
+constexpr std::size_t stree_range_index(const std::uint32_t* data, std::size_t n, char32_t cp) {
+    constexpr std::size_t b = 16;
+    const std::size_t nodes = (n - 1) / b;
+    std::size_t res = n;
+    std::size_t k = 0;
+    while(k < nodes) {
+        const unsigned i = stree_node_rank(data + k * b, cp);
+        res = i == 0 ? res : k * b + i - 1;
+        k = k * (b + 1) + i + 1;
+    }
+    return (res == n || (data[res] >> 8) >= (data[n - 1] >> 8)) ? n : res;
+}
+
+template<range_layout layout>
+constexpr std::size_t range_index(const std::uint32_t* data, std::size_t n, char32_t cp) {
+    if constexpr(layout == range_layout::eytzinger)
+        return eytzinger_range_index(data, n, cp);
+    else if constexpr(layout == range_layout::stree)
+        return stree_range_index(data, n, cp);
+    else
+        return sorted_range_index(data, n, cp);
+}
+
+// First code point of the range after the one holding cp, the end of that range
+constexpr char32_t eytzinger_next_range_start(const std::uint32_t* data, std::size_t n, char32_t cp) {
+    std::size_t k = 1;
+    while(k < n)
+        k = 2 * k + ((data[k] >> 8) <= cp);
+    // the next entry is the last node after which the search went left
+    k >>= countr_zero(~std::uint64_t(k)) + 1;
+    return k == 0 ? 0x110000 : std::min(char32_t(data[k] >> 8), char32_t(0x110000));
+}
+
+constexpr char32_t stree_next_range_start(const std::uint32_t* data, std::size_t n, char32_t cp) {
+    constexpr std::size_t b = 16;
+    const std::size_t nodes = (n - 1) / b;
+    char32_t next = 0x110000;
+    std::size_t k = 0;
+    while(k < nodes) {
+        const unsigned i = stree_node_rank(data + k * b, cp);
+        // the entries of the deeper nodes are closer to cp
+        next = i == b ? next : std::min(char32_t(data[k * b + i] >> 8), next);
+        k = k * (b + 1) + i + 1;
+    }
+    return next;
+}
+
+// A range of a compact_range, and the index of its entry. Empty until it is looked up.
+struct hinted_range {
+    char32_t first = 1;
+    char32_t end = 0;
+    std::size_t index = 0;
+    std::uint8_t value = 0;
+
+    constexpr bool contains(char32_t cp) const {
+        return cp >= first && cp < end;
+    }
+};
+
+// Ranges of the last two code points looked up in a compact_range, the most recent first.
+// Text mostly goes back and forth between two ranges, as between letters and spaces.
+struct range_hint {
+    hinted_range last;
+    hinted_range previous;
+};
+
+// Index of the entry holding cp in sorted entries, searched from the entry of hint.
+// The search gallops away from it, in steps of 1, 2, 4... entries, and ends with a binary search
+// of the last step. Text rarely goes far from its previous range, which takes a few steps.
+// Like the other searches, it returns n if no entry holds cp, before the first one or from the end marker on.
+constexpr std::size_t galloping_range_index(const std::uint32_t* data, std::size_t n, char32_t cp,
+                                            const hinted_range& hint) {
+    std::size_t lo = 0;
+    std::size_t hi = n;
+    std::size_t step = 1;
+    if(cp >= hint.end) {
+        lo = hint.index + 1;
+        hi = lo + 1;
+        while(hi < n && (data[hi] >> 8) <= cp) {
+            lo = hi;
+            step *= 2;
+            hi = std::min(lo + step, n);
+        }
+    } else {
+        if(hint.index == 0 || (data[0] >> 8) > cp)
+            return n;
+        hi = hint.index;
+        lo = hi - 1;
+        while(lo > 0 && (data[lo] >> 8) > cp) {
+            hi = lo;
+            step *= 2;
+            lo = hi > step ? hi - step : 0;
+        }
+    }
+    // data[lo] starts at or before cp, data[hi] after it
+    const auto it = detail::upper_bound(data + lo + 1, data + hi, cp, [](char32_t local_cp, uint32_t v) {
+        char32_t c = (v >> 8);
+        return local_cp < c;
+    });
+    const auto idx = static_cast<std::size_t>(it - data) - 1;
+    return idx == n - 1 ? n : idx;
+}
+
+// UTF-8 sequences are looked up without decoding them first where the layout of a table allows it.
+// Continuation bytes are not validated. A sequence whose lead byte cannot start a sequence,
+// or which is cut short by len, is not a code point: lookups return false or the default value.
+template<typename Char>
+constexpr std::uint32_t utf8_byte(const Char* s, std::size_t i) {
+    return static_cast<unsigned char>(s[i]);
+}
+
+// Length of the sequence starting with the lead byte b, 0 if b cannot start one
+constexpr std::size_t utf8_sequence_length(std::uint32_t b) {
+    if(b < 0x80)
+        return 1;
+    if(b < 0xC2)
+        return 0;
+    if(b < 0xE0)
+        return 2;
+    if(b < 0xF0)
+        return 3;
+    return b < 0xF5 ? 4 : 0;
+}
+
+// Code point of the sequence starting at s, 0x110000 if there is none
+template<typename Char>
+constexpr char32_t utf8_code_point(const Char* s, std::size_t len) {
+    if(len == 0)
+        return 0x110000;
+    const std::uint32_t b0 = utf8_byte(s, 0);
+    if(b0 < 0x80)
+        return b0;
+    const std::size_t n = utf8_sequence_length(b0);
+    if(n == 0 || n > len)
+        return 0x110000;
+    const std::uint32_t b1 = utf8_byte(s, 1) & 0x3F;
+    if(n == 2)
+        return ((b0 & 0x1F) << 6) | b1;
+    const std::uint32_t b2 = utf8_byte(s, 2) & 0x3F;
+    if(n == 3)
+        return ((b0 & 0x0F) << 12) | (b1 << 6) | b2;
+    return ((b0 & 0x07) << 18) | (b1 << 12) | (b2 << 6) | (utf8_byte(s, 3) & 0x3F);
+}
+
+template<typename T, auto N, range_layout layout = range_layout::sorted>
 struct compact_range {
     std::uint32_t _data[N];
     constexpr T value(char32_t cp, T default_value) const {
-        const auto end = std::end(_data);
-        auto it = detail::upper_bound(std::begin(_data), end, cp, [](char32_t local_cp, uint32_t v) {
-            char32_t c = (v >> 8);
-            return local_cp < c;
-        });
-        if(it == end)
+        const auto idx = detail::range_index<layout>(_data, N, cp);
+        if(idx == N)
             return default_value;
-        it--;
-        return *(it)&0xFF;
+        return _data[idx] & 0xFF;
+    }
+    template<typename Char>
+    constexpr T value_utf8(const Char* s, std::size_t len, T default_value) const {
+        const char32_t cp = utf8_code_point(s, len);
+        return cp > 0x10FFFF ? default_value : value(cp, default_value);
+    }
+
+    // Range holding cp, cp <= 0x10FFFF
+    constexpr hinted_range run(char32_t cp) const {
+        range_hint hint;
+        value(cp, 0, hint);
+        return hint.last;
+    }
+
+    // Same as value(cp, default_value), checking the ranges of hint first.
+    // The range holding cp is then the last one of hint.
+    constexpr T value(char32_t cp, T default_value, range_hint& hint) const {
+        if(hint.last.contains(cp))
+            return hint.last.value;
+        if(hint.previous.contains(cp)) {
+            const hinted_range r = hint.previous;
+            hint.previous = hint.last;
+            hint.last = r;
+            return r.value;
+        }
+        if(cp > 0x10FFFF)
+            return default_value;
+        std::size_t idx = N;
+        char32_t end = 0x110000;
+        if constexpr(layout == range_layout::sorted) {
+            // the first lookup has no range to start from
+            idx = hint.last.first <= hint.last.end ? galloping_range_index(_data, N, cp, hint.last)
+                                                   : detail::range_index<layout>(_data, N, cp);
+            if(idx != N)
+                end = std::min(char32_t(_data[idx + 1] >> 8), end);
+        } else {
+            idx = detail::range_index<layout>(_data, N, cp);
+            if constexpr(layout == range_layout::eytzinger)
+                end = eytzinger_next_range_start(_data, N, cp);
+            else
+                end = stree_next_range_start(_data, N, cp);
+        }
+        if(idx == N)
+            return default_value;
+        hint.previous = hint.last;
+        hint.last = {char32_t(_data[idx] >> 8), end, idx, std::uint8_t(_data[idx] & 0xFF)};
+        return hint.last.value;
     }
 };
 template<class T, class... U>
@@ -121,7 +482,7 @@ using array_t = typename array<T, N>::type;
 
 template<std::size_t r1_s, std::size_t r2_s, int16_t r2_t_f, int16_t r2_t_b, std::size_t r3_s,
          std::size_t r4_s, int16_t r4_t_f, int16_t r4_t_b, std::size_t r5_s, int16_t r5_t_f,
-         int16_t r5_t_b, std::size_t r6_s>
+         int16_t r5_t_b, std::size_t r6_s, trie_layout layout = trie_layout::trimmed>
 struct bool_trie {
 
     // not tries, just bitmaps for all code points 0..0x7FF (UTF-8 1- and 2-byte sequences)
@@ -138,36 +499,89 @@ struct bool_trie {
     array_t<std::uint64_t, r6_s> r6;  // again, leaves are shared
 
     constexpr bool lookup(char32_t u) const {
+        if constexpr(layout == trie_layout::padded)
+            return lookup_branchless(u);
         std::uint32_t c = u;
-        if(c < 0x800) {
-            if constexpr(r1_s == 0){
-                return false;
-            }
-            else {
-                return trie_range_leaf(c, r1[std::size_t(c >> 6)]);
-            }
-        } else if(c < 0x10000) {
-            if constexpr(r3_s == 0) {
-                return false;
-            }
-            else {
-                std::size_t i = (std::size_t(c >> 6) - 0x20);
-                auto child = 0;
-                if(i >= r2_t_f && i < r2_t_f + r2_s)
-                    child = r2[i - r2_t_f];
-                return trie_range_leaf(c, r3[child]);
-            }
+        if(c < 0x800)
+            return r1_leaf(c >> 6, c);
+        else if(c < 0x10000)
+            return bmp_leaf(std::size_t(c >> 6) - 0x20, c);
+        else
+            return supplementary_leaf((c >> 12) - 0x10, (c >> 6) & 0x3f, c);
+    }
+
+    // The padded stages cover all the code points of their range: the leaves of c in the three
+    // ranges are loaded, from index 0 outside of their range, and masked to keep the one of c.
+    constexpr bool lookup_branchless(char32_t u) const {
+        static_assert(layout == trie_layout::padded);
+        const std::uint32_t c = u;
+        const std::uint64_t in_r1 = c < 0x800;
+        const std::uint64_t in_bmp = c - 0x800 < 0xF800;
+        const std::uint64_t in_supplementary = c - 0x10000 < 0x100000;
+        std::uint64_t chunk = 0;
+        if constexpr(r1_s != 0)
+            chunk |= r1[(c >> 6) * in_r1] & -in_r1;
+        if constexpr(r3_s != 0)
+            chunk |= r3[r2[((c >> 6) - 0x20) * in_bmp]] & -in_bmp;
+        if constexpr(r6_s != 0) {
+            const std::size_t child = r4[((c >> 12) - 0x10) * in_supplementary];
+            chunk |= r6[r5[(child << 6) | ((c >> 6) & 0x3F)]] & -in_supplementary;
+        }
+        return trie_range_leaf(c, chunk);
+    }
+
+    // The stages match the UTF-8 sequences: the last byte selects the bit of a leaf,
+    // the bytes before it select the leaf.
+    template<typename Char>
+    constexpr bool lookup_utf8(const Char* s, std::size_t len) const {
+        if(len == 0)
+            return false;
+        const std::uint32_t b0 = utf8_byte(s, 0);
+        if(b0 < 0x80)
+            return r1_leaf(b0 >> 6, b0);
+        const std::size_t n = utf8_sequence_length(b0);
+        if(n == 0 || n > len)
+            return false;
+        const std::uint32_t b1 = utf8_byte(s, 1) & 0x3F;
+        if(n == 2)
+            return r1_leaf(b0 & 0x1F, b1);
+        const std::uint32_t b2 = utf8_byte(s, 2) & 0x3F;
+        if(n == 3)
+            return bmp_leaf((std::size_t(b0 & 0x0F) << 6 | b1) - 0x20, b2);
+        return supplementary_leaf(((b0 & 0x07) << 6 | b1) - 0x10, b2, utf8_byte(s, 3));
+    }
+
+    // i is the index of the leaf holding the bit of c, among the leaves of the stage
+    constexpr bool r1_leaf(std::size_t i, std::uint32_t c) const {
+        if constexpr(r1_s == 0) {
+            return false;
+        } else {
+            return trie_range_leaf(c, r1[i]);
+        }
+    }
+
+    constexpr bool bmp_leaf(std::size_t i, std::uint32_t c) const {
+        if constexpr(r3_s == 0) {
+            return false;
+        } else {
+            auto child = 0;
+            if(i >= r2_t_f && i < r2_t_f + r2_s)
+                child = r2[i - r2_t_f];
+            return trie_range_leaf(c, r3[child]);
+        }
+    }
+
+    constexpr bool supplementary_leaf(std::size_t i4, std::size_t mid, std::uint32_t c) const {
+        if constexpr(r6_s == 0) {
+            return false;
         } else {
-            if constexpr(r6_s == 0)
-                return false;
-            std::size_t i4 = (c >> 12) - 0x10;
             auto child = 0;
             if constexpr(r4_s > 0) {
                 if(i4 >= r4_t_f && i4 < r4_t_f + r4_s)
                     child = r4[i4 - r4_t_f];
             }
 
-            std::size_t i5 = static_cast<std::size_t>(std::size_t(child << 6) + (std::size_t(c >> 6) & std::size_t(0x3f)));
+            std::size_t i5 = static_cast<std::size_t>(std::size_t(child << 6) + mid);
             auto leaf = 0;
             if constexpr(r5_s != 0) {
                 if(i5 >= std::size_t(r5_t_f) && i5 < std::size_t(r5_t_f) + r5_s)
@@ -182,11 +596,168 @@ struct bool_trie {
     }
 };
 
+template<std::size_t N>
+using trie_index_t = std::conditional_t<(N <= 0x100), std::uint8_t,
+                     std::conditional_t<(N <= 0x10000), std::uint16_t, std::uint32_t>>;
+
+// Three stage trie mapping every code point to a small value.
+// stage 1 is indexed by the high bits of the code point and selects a block of stage 2,
+// which in turn selects a leaf of stage 3 holding the values of 2^leaf_bits code points.
+// Both blocks and leaves are deduplicated by the generator.
+// stage 1 is truncated after the last block holding a non default value.
+// stage 3 is padded to allow 32 bits loads of its last element.
+template<typename T, std::size_t s1_s, std::size_t s2_s, std::size_t s3_s, unsigned mid_bits,
+         unsigned leaf_bits>
+struct value_trie {
+    trie_index_t<(s2_s >> mid_bits)> s1[s1_s];
+    trie_index_t<(s3_s >> leaf_bits)> s2[s2_s];
+    T s3[s3_s];
+
+    constexpr T lookup(char32_t u, T default_value) const {
+        const std::size_t c = u;
+        const std::size_t i1 = c >> (mid_bits + leaf_bits);
+        if(i1 >= s1_s)
+            return default_value;
+        const std::size_t i2 =
+            (std::size_t(s1[i1]) << mid_bits) | ((c >> leaf_bits) & ((1u << mid_bits) - 1));
+        const std::size_t i3 = (std::size_t(s2[i2]) << leaf_bits) | (c & ((1u << leaf_bits) - 1));
+        return s3[i3];
+    }
+
+    template<typename Char>
+    constexpr T lookup_utf8(const Char* s, std::size_t len, T default_value) const {
+        // ASCII is looked up on its own path, which needs no bound check
+        if(len != 0 && utf8_byte(s, 0) < 0x80)
+            return lookup(utf8_byte(s, 0), default_value);
+        // 0x110000 is past the last block of stage 1
+        return lookup(utf8_code_point(s, len), default_value);
+    }
+};
+
+// Summary of the values of each leaf and block of a value_trie, such as the bits set in any of
+// them. Walks of the trie skip the leaves and blocks whose summary tells enough.
+template<typename S, std::size_t leaves_s, std::size_t blocks_s>
+struct value_trie_summary {
+    S leaves[leaves_s];
+    S blocks[blocks_s];
+};
+
+// Feature::of(v) summarizes a value, Feature::merge(a, b) two summaries
+template<typename Feature, typename T, std::size_t s1_s, std::size_t s2_s, std::size_t s3_s, unsigned mid_bits,
+         unsigned leaf_bits>
+constexpr auto summarize(const value_trie<T, s1_s, s2_s, s3_s, mid_bits, leaf_bits>& trie) {
+    constexpr std::size_t leaf_size = std::size_t(1) << leaf_bits;
+    constexpr std::size_t block_size = std::size_t(1) << mid_bits;
+    value_trie_summary<typename Feature::type, s3_s / leaf_size, s2_s / block_size> summary{};
+    for(std::size_t l = 0; l < s3_s / leaf_size; l++) {
+        summary.leaves[l] = Feature::of(trie.s3[l * leaf_size]);
+        for(std::size_t i = 1; i < leaf_size; i++)
+            summary.leaves[l] = Feature::merge(summary.leaves[l], Feature::of(trie.s3[l * leaf_size + i]));
+    }
+    for(std::size_t b = 0; b < s2_s / block_size; b++) {
+        summary.blocks[b] = summary.leaves[trie.s2[b * block_size]];
+        for(std::size_t i = 1; i < block_size; i++)
+            summary.blocks[b] = Feature::merge(summary.blocks[b], summary.leaves[trie.s2[b * block_size + i]]);
+    }
+    return summary;
+}
+
+// What classify tells of a summary: none, all or some of the values satisfy the predicate
+enum class trie_match : std::uint8_t { none, all, some };
+
+// First code point at or after c whose value satisfies pred (or does not, when want is false),
+// 0x110000 if there is none.
+// Leaves and blocks whose values all, or none of them, satisfy pred are skipped at once.
+template<typename T, std::size_t s1_s, std::size_t s2_s, std::size_t s3_s, unsigned mid_bits,
+         unsigned leaf_bits, typename Summary, typename Classify, typename Pred>
+constexpr char32_t find_value(const value_trie<T, s1_s, s2_s, s3_s, mid_bits, leaf_bits>& trie,
+                              const Summary& summary, std::uint32_t default_value, char32_t c, bool want,
+                              Classify classify, Pred pred) {
+    const trie_match found = want ? trie_match::all : trie_match::none;
+    const trie_match skip = want ? trie_match::none : trie_match::all;
+    constexpr std::size_t limit = s1_s << (mid_bits + leaf_bits);
+    constexpr std::size_t block_mask = (std::size_t(1) << (mid_bits + leaf_bits)) - 1;
+    constexpr std::size_t leaf_mask = (std::size_t(1) << leaf_bits) - 1;
+
+    std::size_t cp = c;
+    while(cp < limit) {
+        const std::size_t b = trie.s1[cp >> (mid_bits + leaf_bits)];
+        const trie_match in_block = classify(summary.blocks[b]);
+        if(in_block == found)
+            return char32_t(cp);
+        if(in_block == skip) {
+            cp = (cp | block_mask) + 1;
+            continue;
+        }
+        const std::size_t l = trie.s2[(b << mid_bits) | ((cp >> leaf_bits) & ((std::size_t(1) << mid_bits) - 1))];
+        const trie_match in_leaf = classify(summary.leaves[l]);
+        if(in_leaf == found)
+            return char32_t(cp);
+        if(in_leaf == skip) {
+            cp = (cp | leaf_mask) + 1;
+            continue;
+        }
+        if(bool(pred(trie.s3[(l << leaf_bits) | (cp & leaf_mask)])) == want)
+            return char32_t(cp);
+        cp++;
+    }
+    if(cp < 0x110000 && bool(pred(static_cast<T>(default_value))) == want)
+        return char32_t(cp);
+    return 0x110000;
+}
+
+// One past the last code point at or before c whose value satisfies pred (or does not, when want
+// is false), 0 if there is none. The backward counterpart of find_value.
+template<typename T, std::size_t s1_s, std::size_t s2_s, std::size_t s3_s, unsigned mid_bits,
+         unsigned leaf_bits, typename Summary, typename Classify, typename Pred>
+constexpr char32_t find_value_before(const value_trie<T, s1_s, s2_s, s3_s, mid_bits, leaf_bits>& trie,
+                                     const Summary& summary, std::uint32_t default_value, char32_t c, bool want,
+                                     Classify classify, Pred pred) {
+    const trie_match found = want ? trie_match::all : trie_match::none;
+    const trie_match skip = want ? trie_match::none : trie_match::all;
+    constexpr std::size_t limit = s1_s << (mid_bits + leaf_bits);
+    constexpr std::size_t block_mask = (std::size_t(1) << (mid_bits + leaf_bits)) - 1;
+    constexpr std::size_t leaf_mask = (std::size_t(1) << leaf_bits) - 1;
+
+    std::size_t cp = c;
+    if(cp >= limit) {
+        if(bool(pred(static_cast<T>(default_value))) == want)
+            return char32_t(cp + 1);
+        if(limit == 0)
+            return 0;
+        cp = limit - 1;
+    }
+    while(true) {
+        const std::size_t b = trie.s1[cp >> (mid_bits + leaf_bits)];
+        const trie_match in_block = classify(summary.blocks[b]);
+        if(in_block == found)
+            return char32_t(cp + 1);
+        if(in_block == skip) {
+            cp &= ~block_mask;
+        } else {
+            const std::size_t l =
+                trie.s2[(b << mid_bits) | ((cp >> leaf_bits) & ((std::size_t(1) << mid_bits) - 1))];
+            const trie_match in_leaf = classify(summary.leaves[l]);
+            if(in_leaf == found)
+                return char32_t(cp + 1);
+            if(in_leaf == skip)
+                cp &= ~leaf_mask;
+            else if(bool(pred(trie.s3[(l << leaf_bits) | (cp & leaf_mask)])) == want)
+                return char32_t(cp + 1);
+        }
+        if(cp == 0)
+            return 0;
+        cp--;
+    }
+}
+
 template<std::size_t size>
 struct flat_array {
     char32_t data[size];
     constexpr bool lookup(char32_t u) const {
-        if constexpr(size < 20) {
+        if constexpr(size == 0) {
+            return false;
+        } else if constexpr(size < 20) {
             for(auto it = std::begin(data); it != std::end(data); ++it) {
                 if(*it == u)
                     return true;
@@ -195,25 +766,33 @@ struct flat_array {
             }
             return false;
         } else {
+#if defined(CEDILLA_SIMD_SEARCH)
+            if(!is_constant_evaluated())
+                return simd_contains(data, size, u);
+#endif
             return detail::binary_search(std::begin(data), std::end(data), u);
         }
     }
+    template<typename Char>
+    constexpr bool lookup_utf8(const Char* s, std::size_t len) const {
+        return lookup(utf8_code_point(s, len));
+    }
 };
 
 
-template<auto N>
+template<auto N, range_layout layout = range_layout::sorted>
 struct range_array {
     std::uint32_t _data[N];
     constexpr bool lookup(char32_t cp) const {
-        const auto end = std::end(_data);
-        auto it = detail::upper_bound(std::begin(_data), end, cp, [](char32_t local_cp, uint32_t v) {
-            char32_t c = (v >> 8);
-            return local_cp < c;
-        });
-        if(it == end)
+        const auto idx = detail::range_index<layout>(_data, N, cp);
+        if(idx == N)
             return false;
-        it--;
-        return (*it) & 0xFF;
+        return _data[idx] & 0xFF;
+    }
+    template<typename Char>
+    constexpr bool lookup_utf8(const Char* s, std::size_t len) const {
+        const char32_t cp = utf8_code_point(s, len);
+        return cp <= 0x10FFFF && lookup(cp);
     }
 };
 
@@ -229,17 +808,12 @@ constexpr char propcharnorm(char a) {
     return a;
 }
 
-constexpr int propcharcomp(char a, char b) {
-    a = propcharnorm(a);
-    b = propcharnorm(b);
-    if(a == b)
-        return 0;
-    if(a < b)
-        return -1;
-    return 1;
+// UAX44-LM3: case, whitespace, underscores and hyphens are ignored when matching names
+constexpr bool propcharignored(char a) {
+    return a == ' ' || a == '_' || a == '-' || (a >= '\t' && a <= '\r');
 }
 
-constexpr int propnamecomp(std::string_view sa, std::string_view sb) {
+constexpr bool propnameeq(std::string_view sa, std::string_view sb) {
     // workaround, iterators in std::string_view are not constexpr in libc++ (for now)
     const char* a = sa.data();
     const char* b = sb.data();
@@ -247,16 +821,36 @@ constexpr int propnamecomp(std::string_view sa, std::string_view sb) {
     const char* ae = sa.data() + sa.size();
     const char* be = sb.data() + sb.size();
 
-    for(; a != ae && b != be; a++, b++) {
-        auto res = propcharcomp(*a, *b);
-        if(res != 0)
-            return res;
+    for(;; a++, b++) {
+        while(a != ae && propcharignored(*a))
+            a++;
+        while(b != be && propcharignored(*b))
+            b++;
+        if(a == ae || b == be)
+            return a == ae && b == be;
+        if(propcharnorm(*a) != propcharnorm(*b))
+            return false;
     }
-    if(sa.size() < sb.size())
-        return -1;
-    else if(sb.size() < sa.size())
-        return 1;
-    return 0;
+}
+
+// FNV-1a of the loose form of a name, gen.py computes the same hash
+constexpr std::uint32_t propnamehash(std::string_view s) {
+    std::uint32_t h = 2166136261u;
+    for(const char* c = s.data(); c != s.data() + s.size(); c++) {
+        if(propcharignored(*c))
+            continue;
+        h = (h ^ static_cast<unsigned char>(propcharnorm(*c))) * 16777619u;
+    }
+    return h;
+}
+
+constexpr std::uint32_t propnamemix(std::uint32_t h, std::uint32_t seed) {
+    h ^= seed * 0x9E3779B9u;
+    h ^= h >> 16;
+    h *= 0x85EBCA6Bu;
+    h ^= h >> 13;
+    h *= 0xC2B2AE35u;
+    return h ^ (h >> 16);
 }
 
 template <typename A, typename B>
@@ -271,6 +865,55 @@ pair(A, B) -> pair<A, B>;
 
 struct string_with_idx { const char* name; uint32_t value; };
 
+// Names of the values of a property, laid out by a minimal perfect hash:
+// a name is in entries[mix(h, seeds[mix(h, 0) % B]) % N], h being the hash of its loose form.
+template<std::size_t N, std::size_t B>
+struct string_table {
+    string_with_idx entries[N];
+    std::uint16_t seeds[B];
+
+    constexpr const string_with_idx* find(std::string_view s) const {
+        const auto h = propnamehash(s);
+        const auto& e = entries[propnamemix(h, seeds[propnamemix(h, 0) % B]) % N];
+        return propnameeq(s, e.name) ? &e : nullptr;
+    }
+};
+
+struct code_point_record {
+    std::uint8_t category;
+    std::uint8_t script;
+    std::uint16_t block;
+    std::uint8_t age;
+    std::uint8_t numeric_type;
+    std::uint8_t script_extensions;
+};
+
+// Everything about a code point of U+0000..U+00FF, which most text is made of.
+// Lookups check these records before any other table.
+struct latin1_record {
+    std::uint64_t properties;    // one bit per property, as the property_rows
+    std::uint8_t category;
+    std::uint8_t script;
+    std::uint8_t block;
+    std::uint8_t age;
+    std::uint16_t info;    // index of the cp_info_records entry
+};
+
+// How a binary property of the regex support is answered
+enum class binary_prop_kind : std::uint8_t { property, category, script, script_extensions, any, ascii, assigned };
+
+struct binary_prop_descriptor {
+    binary_prop_kind kind;
+    // the property, category or script enumerator
+    std::uint8_t value;
+};
+
+struct numeric_record {
+    std::int64_t numerator;
+    std::int16_t denominator;
+    std::uint8_t numeric_type;
+};
+
 
 }    // namespace uni::detail
 
@@ -292,7 +935,11 @@ constexpr bool numeric_value::is_valid() const {
     return _d != 0;
 }
 
-constexpr numeric_value::numeric_value(long long n, int16_t d) : _n(n), _d(d) {}
+constexpr numeric_type numeric_value::type() const {
+    return static_cast<numeric_type>(_type);
+}
+
+constexpr numeric_value::numeric_value(long long n, int16_t d, std::uint8_t type) : _n(n), _d(d), _type(type) {}
 
 
 }    // namespace uni
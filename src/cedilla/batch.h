@@ -0,0 +1,594 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include "cedilla/unicode.h"
+
+// The vectorized kernels of the batch lookups are built for each instruction set they support,
+// the lookups run the best one the host has, detected on first use, see batch_simd_level.
+// GCC and Clang compile them for x86 targets that lack these instructions with target attributes,
+// other compilers only build the kernels of the instructions the target enables.
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define CEDILLA_BATCH_DISPATCH
+#define CEDILLA_TARGET_SSE42 __attribute__((target("sse4.2")))
+#define CEDILLA_TARGET_AVX2 __attribute__((target("avx2")))
+#define CEDILLA_TARGET_AVX512 __attribute__((target("avx512f")))
+// inlines the kernel into the function compiled for its instruction set
+#define CEDILLA_TARGET_FLATTEN __attribute__((flatten))
+// functions of any instruction set handling vectors, always inlined into those of one instruction set
+#define CEDILLA_VECTOR_INLINE __attribute__((always_inline)) inline
+#else
+#define CEDILLA_TARGET_SSE42
+#define CEDILLA_TARGET_AVX2
+#define CEDILLA_TARGET_AVX512
+#define CEDILLA_TARGET_FLATTEN
+#define CEDILLA_VECTOR_INLINE inline
+#endif
+
+#if defined(CEDILLA_BATCH_DISPATCH) || defined(__SSE4_2__)
+#define CEDILLA_BATCH_SSE42
+#endif
+#if defined(CEDILLA_BATCH_DISPATCH) || defined(__AVX2__)
+#define CEDILLA_BATCH_AVX2
+#endif
+#if defined(CEDILLA_BATCH_DISPATCH) || defined(__AVX512F__)
+#define CEDILLA_BATCH_AVX512
+#endif
+
+#if defined(CEDILLA_BATCH_SSE42) || defined(CEDILLA_BATCH_AVX2) || defined(CEDILLA_BATCH_AVX512)
+#include <immintrin.h>
+#endif
+
+// GCC warns that the vectors returned by the functions of one instruction set to the functions of any
+// would have another ABI, but the latter are always inlined into functions of the same instruction set
+#if defined(CEDILLA_BATCH_DISPATCH) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpsabi"
+#endif
+
+namespace uni::detail {
+
+// Number of code points whose trie walks the vectorized batch lookups interleave: the gathers of
+// one stage are issued for all of their vectors before the next stage, and their latencies overlap.
+// Below two vectors, the vectors are walked one at a time. By default 8 vectors of the instruction
+// set the lookups run, past which their registers spill: 32 code points with SSE4.2, 64 with AVX2,
+// 128 with AVX-512. CEDILLA_BATCH_PREFETCH_DISTANCE sets it for all of them.
+inline constexpr std::size_t batch_distance_unset = std::size_t(-1);
+#ifdef CEDILLA_BATCH_PREFETCH_DISTANCE
+inline constexpr std::size_t default_batch_distance = CEDILLA_BATCH_PREFETCH_DISTANCE;
+#else
+inline constexpr std::size_t default_batch_distance = batch_distance_unset;
+#endif
+
+// Number of vectors of width code points interleaved for distance
+constexpr std::size_t batch_interleaved_vectors(std::size_t distance, std::size_t width) {
+    if(distance == batch_distance_unset)
+        return 8;
+    return distance / width > 1 ? distance / width : 1;
+}
+
+// Values of the code points 0..0x7FF (UTF-8 1- and 2-byte sequences), computed at compile time.
+// Batch lookups answer these without walking the trie.
+struct low_table {
+    // padded so that 32 bits loads of the last entries stay in the table
+    std::uint8_t data[0x800 + 3];
+};
+
+template<typename Kernel>
+constexpr low_table make_low_table() {
+    low_table t{};
+    for(char32_t c = 0; c < 0x800; c++)
+        t.data[c] = Kernel::low(c);
+    return t;
+}
+
+template<typename Kernel>
+inline constexpr low_table low_table_v = make_low_table<Kernel>();
+
+// A kernel describes a batch lookup: a value_trie, the default value of that trie,
+// how to turn a trie value into the result (map) and the scalar equivalent (value).
+// The low table holds low(c), from_low and map_low turn its entries into results.
+// map and map_low transform their vector in place, so that no vector is passed by value to a function
+// compiled for no instruction set in particular, whose ABI would then depend on the flags of the build.
+struct direct_low_kernel {
+    static std::uint8_t from_low(std::uint8_t v) {
+        return v;
+    }
+    template<typename V>
+    CEDILLA_VECTOR_INLINE static void map_low(typename V::reg&) {}
+};
+
+struct category_kernel : direct_low_kernel {
+    static constexpr const auto& trie() {
+        return tables::category_data;
+    }
+    static constexpr std::uint32_t trie_default = static_cast<std::uint32_t>(category::cn);
+    static constexpr std::uint8_t low(char32_t c) {
+        return value(c);
+    }
+    static constexpr std::uint8_t value(char32_t c) {
+        return static_cast<std::uint8_t>(cp_category(c));
+    }
+    template<typename V>
+    CEDILLA_VECTOR_INLINE static void map(typename V::reg&) {}
+};
+
+struct script_kernel : direct_low_kernel {
+    static constexpr const auto& trie() {
+        return tables::cp_info_data;
+    }
+    static constexpr std::uint32_t trie_default = 0;
+    static constexpr std::uint8_t low(char32_t c) {
+        return value(c);
+    }
+    static constexpr std::uint8_t value(char32_t c) {
+        return static_cast<std::uint8_t>(cp_info(c).script());
+    }
+    template<typename V>
+    CEDILLA_VECTOR_INLINE static void map(typename V::reg& v) {
+        static_assert(sizeof(code_point_record) == 8);
+        const auto base = reinterpret_cast<const char*>(tables::cp_info_records) + offsetof(code_point_record, script);
+        v = V::and_(V::template gather<1>(base, V::template sll<3>(v)), V::set1(0xFF));
+    }
+};
+
+template<property p>
+struct property_kernel : direct_low_kernel {
+    static constexpr const auto& trie() {
+        return tables::property_data;
+    }
+    static constexpr std::uint32_t trie_default = 0;
+    static constexpr std::uint8_t low(char32_t c) {
+        return value(c);
+    }
+    static constexpr std::uint8_t value(char32_t c) {
+        return cp_property_is<p>(c);
+    }
+    template<typename V>
+    CEDILLA_VECTOR_INLINE static void map(typename V::reg& v) {
+        constexpr unsigned bit = static_cast<unsigned>(p);
+        const auto base = reinterpret_cast<const char*>(tables::property_rows) + (bit / 32) * 4;
+        const auto half = V::template gather<1>(base, V::template sll<3>(v));
+        v = V::and_(V::template srl<bit % 32>(half), V::set1(1));
+    }
+};
+
+// Property chosen at runtime: the low table holds property rows, that are numbered
+// in code point order so that the rows of the code points below 0x800 fit in a byte.
+// More rows would make gen.py widen property_data and low() would truncate them.
+static_assert(std::size(tables::property_rows) <= 0x100);
+struct runtime_property_kernel {
+    unsigned bit;
+
+    static constexpr const auto& trie() {
+        return tables::property_data;
+    }
+    static constexpr std::uint32_t trie_default = 0;
+    static constexpr std::uint8_t low(char32_t c) {
+        return static_cast<std::uint8_t>(tables::property_data.lookup(c, 0));
+    }
+    std::uint8_t from_low(std::uint8_t row) const {
+        return (tables::property_rows[row] >> bit) & 1;
+    }
+    std::uint8_t value(char32_t c) const {
+        return cp_property_is(static_cast<property>(bit), c);
+    }
+    template<typename V>
+    CEDILLA_VECTOR_INLINE void map(typename V::reg& v) const {
+        const auto base = reinterpret_cast<const char*>(tables::property_rows) + (bit / 32) * 4;
+        const auto half = V::template gather<1>(base, V::template sll<3>(v));
+        v = V::and_(V::srl(half, bit % 32), V::set1(1));
+    }
+    template<typename V>
+    CEDILLA_VECTOR_INLINE void map_low(typename V::reg& v) const {
+        map<V>(v);
+    }
+};
+
+#if defined(CEDILLA_BATCH_SSE42)
+// SSE4.2 has no gathers, their lanes are loaded one by one
+struct sse42 {
+    using reg = __m128i;
+    static constexpr std::size_t width = 4;
+
+    CEDILLA_TARGET_SSE42 static reg load(const char32_t* p) {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    }
+    CEDILLA_TARGET_SSE42 static reg set1(std::uint32_t v) {
+        return _mm_set1_epi32(static_cast<int>(v));
+    }
+    template<int scale>
+    CEDILLA_TARGET_SSE42 static reg gather(const void* base, reg idx) {
+        const auto bytes = static_cast<const char*>(base);
+        std::uint32_t v[4];
+        std::memcpy(&v[0], bytes + std::ptrdiff_t(_mm_extract_epi32(idx, 0)) * scale, 4);
+        std::memcpy(&v[1], bytes + std::ptrdiff_t(_mm_extract_epi32(idx, 1)) * scale, 4);
+        std::memcpy(&v[2], bytes + std::ptrdiff_t(_mm_extract_epi32(idx, 2)) * scale, 4);
+        std::memcpy(&v[3], bytes + std::ptrdiff_t(_mm_extract_epi32(idx, 3)) * scale, 4);
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(v));
+    }
+    CEDILLA_TARGET_SSE42 static reg and_(reg a, reg b) {
+        return _mm_and_si128(a, b);
+    }
+    CEDILLA_TARGET_SSE42 static reg or_(reg a, reg b) {
+        return _mm_or_si128(a, b);
+    }
+    template<unsigned n>
+    CEDILLA_TARGET_SSE42 static reg srl(reg a) {
+        return _mm_srli_epi32(a, n);
+    }
+    template<unsigned n>
+    CEDILLA_TARGET_SSE42 static reg sll(reg a) {
+        return _mm_slli_epi32(a, n);
+    }
+    CEDILLA_TARGET_SSE42 static reg srl(reg a, unsigned n) {
+        return _mm_srl_epi32(a, _mm_cvtsi32_si128(static_cast<int>(n)));
+    }
+    // lanes < n, n and the lanes are both at most 2^31
+    CEDILLA_TARGET_SSE42 static reg less(reg a, std::uint32_t n) {
+        return _mm_cmpgt_epi32(set1(n), a);
+    }
+    CEDILLA_TARGET_SSE42 static bool all_below(reg a, std::uint32_t n) {
+        const auto below = _mm_cmpeq_epi32(_mm_min_epu32(a, set1(n - 1)), a);
+        return _mm_movemask_epi8(below) == 0xFFFF;
+    }
+    CEDILLA_TARGET_SSE42 static reg select(reg mask, reg a, reg b) {
+        return _mm_blendv_epi8(b, a, mask);
+    }
+    template<typename Out>
+    CEDILLA_TARGET_SSE42 static void store(reg v, Out* out) {
+        if constexpr(sizeof(Out) == 4) {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out), v);
+        } else {
+            static_assert(sizeof(Out) == 1);
+            const auto words = _mm_packus_epi32(v, v);
+            const std::uint32_t bytes = static_cast<std::uint32_t>(_mm_cvtsi128_si32(_mm_packus_epi16(words, words)));
+            std::memcpy(out, &bytes, 4);
+        }
+    }
+};
+#endif
+
+#if defined(CEDILLA_BATCH_AVX2)
+struct avx2 {
+    using reg = __m256i;
+    static constexpr std::size_t width = 8;
+
+    CEDILLA_TARGET_AVX2 static reg load(const char32_t* p) {
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    }
+    CEDILLA_TARGET_AVX2 static reg set1(std::uint32_t v) {
+        return _mm256_set1_epi32(static_cast<int>(v));
+    }
+    template<int scale>
+    CEDILLA_TARGET_AVX2 static reg gather(const void* base, reg idx) {
+        return _mm256_i32gather_epi32(static_cast<const int*>(base), idx, scale);
+    }
+    CEDILLA_TARGET_AVX2 static reg and_(reg a, reg b) {
+        return _mm256_and_si256(a, b);
+    }
+    CEDILLA_TARGET_AVX2 static reg or_(reg a, reg b) {
+        return _mm256_or_si256(a, b);
+    }
+    template<unsigned n>
+    CEDILLA_TARGET_AVX2 static reg srl(reg a) {
+        return _mm256_srli_epi32(a, n);
+    }
+    template<unsigned n>
+    CEDILLA_TARGET_AVX2 static reg sll(reg a) {
+        return _mm256_slli_epi32(a, n);
+    }
+    CEDILLA_TARGET_AVX2 static reg srl(reg a, unsigned n) {
+        return _mm256_srl_epi32(a, _mm_cvtsi32_si128(static_cast<int>(n)));
+    }
+    // lanes < n, n and the lanes are both at most 2^31
+    CEDILLA_TARGET_AVX2 static reg less(reg a, std::uint32_t n) {
+        return _mm256_cmpgt_epi32(set1(n), a);
+    }
+    CEDILLA_TARGET_AVX2 static bool all_below(reg a, std::uint32_t n) {
+        const auto below = _mm256_cmpeq_epi32(_mm256_min_epu32(a, set1(n - 1)), a);
+        return _mm256_movemask_epi8(below) == -1;
+    }
+    CEDILLA_TARGET_AVX2 static reg select(reg mask, reg a, reg b) {
+        return _mm256_blendv_epi8(b, a, mask);
+    }
+    template<typename Out>
+    CEDILLA_TARGET_AVX2 static void store(reg v, Out* out) {
+        if constexpr(sizeof(Out) == 4) {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), v);
+        } else {
+            static_assert(sizeof(Out) == 1);
+            const auto bytes = _mm256_packus_epi16(_mm256_packus_epi32(v, v), _mm256_packus_epi32(v, v));
+            const std::uint32_t lo = static_cast<std::uint32_t>(_mm256_extract_epi32(bytes, 0));
+            const std::uint32_t hi = static_cast<std::uint32_t>(_mm256_extract_epi32(bytes, 4));
+            std::memcpy(out, &lo, 4);
+            std::memcpy(out + 4, &hi, 4);
+        }
+    }
+};
+#endif
+
+#if defined(CEDILLA_BATCH_AVX512)
+struct avx512 {
+    using reg = __m512i;
+    static constexpr std::size_t width = 16;
+    // the masked forms of the intrinsics avoid spurious -Wmaybe-uninitialized with GCC 12
+    static constexpr __mmask16 all = 0xFFFF;
+
+    CEDILLA_TARGET_AVX512 static reg load(const char32_t* p) {
+        return _mm512_loadu_si512(p);
+    }
+    CEDILLA_TARGET_AVX512 static reg set1(std::uint32_t v) {
+        return _mm512_maskz_set1_epi32(all, static_cast<int>(v));
+    }
+    template<int scale>
+    CEDILLA_TARGET_AVX512 static reg gather(const void* base, reg idx) {
+        return _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), all, idx, base, scale);
+    }
+    CEDILLA_TARGET_AVX512 static reg and_(reg a, reg b) {
+        return _mm512_and_si512(a, b);
+    }
+    CEDILLA_TARGET_AVX512 static reg or_(reg a, reg b) {
+        return _mm512_or_si512(a, b);
+    }
+    template<unsigned n>
+    CEDILLA_TARGET_AVX512 static reg srl(reg a) {
+        return _mm512_maskz_srli_epi32(all, a, n);
+    }
+    template<unsigned n>
+    CEDILLA_TARGET_AVX512 static reg sll(reg a) {
+        return _mm512_maskz_slli_epi32(all, a, n);
+    }
+    CEDILLA_TARGET_AVX512 static reg srl(reg a, unsigned n) {
+        return _mm512_maskz_srl_epi32(all, a, _mm_cvtsi32_si128(static_cast<int>(n)));
+    }
+    CEDILLA_TARGET_AVX512 static __mmask16 less(reg a, std::uint32_t n) {
+        return _mm512_cmplt_epu32_mask(a, set1(n));
+    }
+    CEDILLA_TARGET_AVX512 static bool all_below(reg a, std::uint32_t n) {
+        return less(a, n) == all;
+    }
+    CEDILLA_TARGET_AVX512 static reg select(__mmask16 mask, reg a, reg b) {
+        return _mm512_mask_blend_epi32(mask, b, a);
+    }
+    template<typename Out>
+    CEDILLA_TARGET_AVX512 static void store(reg v, Out* out) {
+        if constexpr(sizeof(Out) == 4) {
+            _mm512_storeu_si512(out, v);
+        } else {
+            static_assert(sizeof(Out) == 1);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm512_maskz_cvtepi32_epi8(all, v));
+        }
+    }
+};
+#endif
+
+// Walks the three stages of a value_trie for n vectors of V::width code points, the gathers of each
+// stage being issued for all of them before the next stage.
+// The stages are read with 32 bits gathers and masked down to their element size,
+// the generator pads the last stage so that these reads stay in the table.
+template<typename V, std::size_t n, typename T, std::size_t s1_s, std::size_t s2_s, std::size_t s3_s,
+         unsigned mid_bits, unsigned leaf_bits>
+CEDILLA_VECTOR_INLINE void gather_value_tries(const value_trie<T, s1_s, s2_s, s3_s, mid_bits, leaf_bits>& trie,
+                                              const typename V::reg (&c)[n], typename V::reg (&v)[n],
+                                              std::uint32_t default_value) {
+    constexpr auto mask_of = [](std::size_t size) -> std::uint32_t {
+        return size == 4 ? 0xFFFFFFFF : (std::uint32_t(1) << (size * 8)) - 1;
+    };
+    constexpr int e1 = sizeof(trie.s1[0]);
+    constexpr int e2 = sizeof(trie.s2[0]);
+    constexpr int e3 = sizeof(trie.s3[0]);
+
+    decltype(V::less(c[0], 0)) valid[n];
+    for(std::size_t j = 0; j < n; j++) {
+        const auto i1 = V::template srl<mid_bits + leaf_bits>(c[j]);
+        valid[j] = V::less(i1, static_cast<std::uint32_t>(s1_s));
+        v[j] = V::select(valid[j], i1, V::set1(0));
+    }
+    for(std::size_t j = 0; j < n; j++) {
+        const auto b1 = V::and_(V::template gather<e1>(trie.s1, v[j]), V::set1(mask_of(e1)));
+        v[j] = V::or_(V::template sll<mid_bits>(b1),
+                      V::and_(V::template srl<leaf_bits>(c[j]), V::set1((1u << mid_bits) - 1)));
+    }
+    for(std::size_t j = 0; j < n; j++) {
+        const auto b2 = V::and_(V::template gather<e2>(trie.s2, v[j]), V::set1(mask_of(e2)));
+        v[j] = V::or_(V::template sll<leaf_bits>(b2), V::and_(c[j], V::set1((1u << leaf_bits) - 1)));
+    }
+    for(std::size_t j = 0; j < n; j++) {
+        const auto r = V::and_(V::template gather<e3>(trie.s3, v[j]), V::set1(mask_of(e3)));
+        v[j] = V::select(valid[j], r, V::set1(default_value));
+    }
+}
+
+template<typename V, typename Kernel, typename Out>
+CEDILLA_VECTOR_INLINE const char32_t* batch_lookup_simd(const Kernel& k, const char32_t* first, const char32_t* last,
+                                                        Out*& out) {
+    const auto& low = low_table_v<Kernel>;
+    for(; std::size_t(last - first) >= V::width; first += V::width, out += V::width) {
+        const typename V::reg c[1] = {V::load(first)};
+        typename V::reg v[1];
+        if(V::all_below(c[0], 0x800)) {
+            v[0] = V::and_(V::template gather<1>(low.data, c[0]), V::set1(0xFF));
+            k.template map_low<V>(v[0]);
+        } else {
+            gather_value_tries<V>(Kernel::trie(), c, v, Kernel::trie_default);
+            k.template map<V>(v[0]);
+        }
+        V::store(v[0], out);
+    }
+    return first;
+}
+
+// Same as batch_lookup_simd, walking the tries of n vectors at once
+template<typename V, std::size_t n, typename Kernel, typename Out>
+CEDILLA_VECTOR_INLINE const char32_t* batch_lookup_simd_interleaved(const Kernel& k, const char32_t* first,
+                                                                    const char32_t* last, Out*& out) {
+    const auto& low = low_table_v<Kernel>;
+    for(; std::size_t(last - first) >= n * V::width; first += n * V::width, out += n * V::width) {
+        typename V::reg c[n];
+        bool all_low = true;
+        for(std::size_t j = 0; j < n; j++) {
+            c[j] = V::load(first + j * V::width);
+            all_low = all_low && V::all_below(c[j], 0x800);
+        }
+        typename V::reg v[n];
+        if(all_low) {
+            for(std::size_t j = 0; j < n; j++) {
+                v[j] = V::and_(V::template gather<1>(low.data, c[j]), V::set1(0xFF));
+                k.template map_low<V>(v[j]);
+                V::store(v[j], out + j * V::width);
+            }
+            continue;
+        }
+        gather_value_tries<V>(Kernel::trie(), c, v, Kernel::trie_default);
+        for(std::size_t j = 0; j < n; j++) {
+            k.template map<V>(v[j]);
+            V::store(v[j], out + j * V::width);
+        }
+    }
+    return batch_lookup_simd<V>(k, first, last, out);
+}
+
+// Vectorized part of a batch lookup with V, returns where the scalar tail starts
+template<typename V, std::size_t distance, typename Kernel, typename Out>
+CEDILLA_VECTOR_INLINE const char32_t* batch_lookup_vectors(const Kernel& k, const char32_t* first, const char32_t* last,
+                                                           Out*& out) {
+    constexpr std::size_t n = batch_interleaved_vectors(distance, V::width);
+    if constexpr(n >= 2)
+        return batch_lookup_simd_interleaved<V, n>(k, first, last, out);
+    else
+        return batch_lookup_simd<V>(k, first, last, out);
+}
+
+#if defined(CEDILLA_BATCH_SSE42)
+template<std::size_t distance, typename Kernel, typename Out>
+CEDILLA_TARGET_SSE42 CEDILLA_TARGET_FLATTEN const char32_t* batch_lookup_sse42(const Kernel& k, const char32_t* first,
+                                                                               const char32_t* last, Out*& out) {
+    return batch_lookup_vectors<sse42, distance>(k, first, last, out);
+}
+#endif
+
+#if defined(CEDILLA_BATCH_AVX2)
+template<std::size_t distance, typename Kernel, typename Out>
+CEDILLA_TARGET_AVX2 CEDILLA_TARGET_FLATTEN const char32_t* batch_lookup_avx2(const Kernel& k, const char32_t* first,
+                                                                             const char32_t* last, Out*& out) {
+    return batch_lookup_vectors<avx2, distance>(k, first, last, out);
+}
+#endif
+
+#if defined(CEDILLA_BATCH_AVX512)
+template<std::size_t distance, typename Kernel, typename Out>
+CEDILLA_TARGET_AVX512 CEDILLA_TARGET_FLATTEN const char32_t* batch_lookup_avx512(const Kernel& k, const char32_t* first,
+                                                                                 const char32_t* last, Out*& out) {
+    return batch_lookup_vectors<avx512, distance>(k, first, last, out);
+}
+#endif
+
+// Best level of the host among those the batch lookups are built for
+inline simd_level detect_simd_level() {
+#if defined(CEDILLA_BATCH_DISPATCH)
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("avx512f"))
+        return simd_level::avx512;
+    if(__builtin_cpu_supports("avx2"))
+        return simd_level::avx2;
+    if(__builtin_cpu_supports("sse4.2"))
+        return simd_level::sse42;
+    return simd_level::scalar;
+#elif defined(CEDILLA_BATCH_AVX512)
+    return simd_level::avx512;
+#elif defined(CEDILLA_BATCH_AVX2)
+    return simd_level::avx2;
+#elif defined(CEDILLA_BATCH_SSE42)
+    return simd_level::sse42;
+#else
+    return simd_level::scalar;
+#endif
+}
+
+inline std::atomic<simd_level>& batch_level() {
+    static std::atomic<simd_level> level{host_simd_level()};
+    return level;
+}
+
+template<std::size_t distance = default_batch_distance, typename Kernel, typename Out>
+void batch_lookup(const Kernel& k, const char32_t* first, const char32_t* last, Out* out) {
+    switch(batch_level().load(std::memory_order_relaxed)) {
+#if defined(CEDILLA_BATCH_AVX512)
+        case simd_level::avx512:
+            first = batch_lookup_avx512<distance>(k, first, last, out);
+            break;
+#endif
+#if defined(CEDILLA_BATCH_AVX2)
+        case simd_level::avx2:
+            first = batch_lookup_avx2<distance>(k, first, last, out);
+            break;
+#endif
+#if defined(CEDILLA_BATCH_SSE42)
+        case simd_level::sse42:
+            first = batch_lookup_sse42<distance>(k, first, last, out);
+            break;
+#endif
+        default: break;
+    }
+    // Testing each code point against 0x800 mispredicts on mixed text, test blocks instead
+    constexpr std::size_t block = 8;
+    const auto& low = low_table_v<Kernel>;
+    for(; std::size_t(last - first) >= block; first += block, out += block) {
+        char32_t bits = 0;
+        for(std::size_t i = 0; i < block; i++)
+            bits |= first[i];
+        if(bits < 0x800) {
+            for(std::size_t i = 0; i < block; i++)
+                out[i] = static_cast<Out>(k.from_low(low.data[first[i]]));
+        } else {
+            for(std::size_t i = 0; i < block; i++)
+                out[i] = static_cast<Out>(k.value(first[i]));
+        }
+    }
+    for(; first != last; ++first, ++out)
+        *out = static_cast<Out>(k.value(*first));
+}
+
+}    // namespace uni::detail
+
+namespace uni {
+
+inline simd_level host_simd_level() {
+    static const simd_level level = detail::detect_simd_level();
+    return level;
+}
+
+inline simd_level batch_simd_level() {
+    return detail::batch_level().load(std::memory_order_relaxed);
+}
+
+inline bool set_batch_simd_level(simd_level level) {
+    if(level > host_simd_level())
+        return false;
+    detail::batch_level().store(level, std::memory_order_relaxed);
+    return true;
+}
+
+inline void cp_category(const char32_t* first, const char32_t* last, category* out) {
+    detail::batch_lookup(detail::category_kernel{}, first, last, out);
+}
+
+inline void cp_script(const char32_t* first, const char32_t* last, script* out) {
+    detail::batch_lookup(detail::script_kernel{}, first, last, out);
+}
+
+template<property p>
+void cp_property_is(const char32_t* first, const char32_t* last, bool* out) {
+    detail::batch_lookup(detail::property_kernel<p>{}, first, last, out);
+}
+
+inline void cp_property_is(property p, const char32_t* first, const char32_t* last, bool* out) {
+    detail::batch_lookup(detail::runtime_property_kernel{static_cast<unsigned>(p)}, first, last, out);
+}
+
+}    // namespace uni
+
+#if defined(CEDILLA_BATCH_DISPATCH) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
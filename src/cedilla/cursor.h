@@ -0,0 +1,52 @@
+#pragma once
+#include "cedilla/unicode.h"
+
+// Lookups of sequential text. A cursor remembers the ranges of the last two code points it looked up
+// in each table: consecutive code points mostly share their script, age and block, or go back and
+// forth between two of them, and a lookup in a remembered range reads no table.
+
+namespace uni {
+
+class lookup_cursor {
+public:
+    constexpr script cp_script(char32_t cp) {
+        return static_cast<script>(detail::tables::script_data.value(cp, uint8_t(script::unknown), m_script));
+    }
+
+    constexpr version cp_age(char32_t cp) {
+        return static_cast<version>(detail::tables::age_data.value(cp, uint8_t(version::unassigned), m_age));
+    }
+
+    constexpr block cp_block(char32_t cp) {
+        if(in(m_blocks[0], cp))
+            return m_blocks[0].b;
+        if(in(m_blocks[1], cp)) {
+            const block_entry e = m_blocks[1];
+            m_blocks[1] = m_blocks[0];
+            m_blocks[0] = e;
+            return e.b;
+        }
+        const block b = uni::cp_block(cp);
+        // code points in no block are not in a range of the table
+        if(b != block::no_block) {
+            m_blocks[1] = m_blocks[0];
+            m_blocks[0] = {block_range(b), b};
+        }
+        return b;
+    }
+
+private:
+    struct block_entry {
+        code_point_range range = {1, 0};
+        block b = block::no_block;
+    };
+    static constexpr bool in(const block_entry& e, char32_t cp) {
+        return cp >= e.range.first && cp <= e.range.last;
+    }
+
+    detail::range_hint m_script;
+    detail::range_hint m_age;
+    block_entry m_blocks[2];
+};
+
+}    // namespace uni
@@ -0,0 +1,269 @@
+#pragma once
+#include "cedilla/unicode.h"
+
+// Ranges of code points having a property, category, script or block,
+// read from the tables without probing every code point.
+
+namespace uni::detail {
+
+// Summaries of the values of the leaves and blocks of the tries, see summarize
+struct category_feature {
+    using type = std::uint64_t;
+    static constexpr const auto& trie() {
+        return tables::category_data;
+    }
+    static constexpr type of(std::uint8_t c) {
+        return std::uint64_t(1) << c;
+    }
+    static constexpr type merge(type a, type b) {
+        return a | b;
+    }
+};
+
+struct property_feature {
+    // properties of any, and of all the code points
+    struct type {
+        std::uint64_t any;
+        std::uint64_t all;
+    };
+    static constexpr const auto& trie() {
+        return tables::property_data;
+    }
+    static constexpr type of(std::uint8_t row) {
+        return {tables::property_rows[row], tables::property_rows[row]};
+    }
+    static constexpr type merge(type a, type b) {
+        return {a.any | b.any, a.all & b.all};
+    }
+};
+
+struct script_feature {
+    // the script of all the code points, or mixed
+    using type = std::uint16_t;
+    static constexpr type mixed = 0xFFFF;
+    static constexpr const auto& trie() {
+        return tables::cp_info_data;
+    }
+    template<typename R>
+    static constexpr type of(R record) {
+        return tables::cp_info_records[record].script;
+    }
+    static constexpr type merge(type a, type b) {
+        return a == b ? a : mixed;
+    }
+};
+
+template<typename Feature>
+inline constexpr auto trie_summary_v = summarize<Feature>(Feature::trie());
+
+// Sources of ranges: find(c, want) returns the first code point at or after c that is in the
+// range (or not in it, when want is false), 0x110000 if there is none.
+// before(c, want) returns one past the last code point at or before c that is, 0 if there is none.
+struct property_ranges {
+    std::uint64_t bit;
+    constexpr auto classify() const {
+        const auto m = bit;
+        return [m](property_feature::type s) {
+            return (s.any & m) == 0 ? trie_match::none : (s.all & m) ? trie_match::all : trie_match::some;
+        };
+    }
+    constexpr auto pred() const {
+        const auto m = bit;
+        return [m](std::uint8_t row) { return (tables::property_rows[row] & m) != 0; };
+    }
+    constexpr char32_t find(char32_t c, bool want) const {
+        return find_value(property_feature::trie(), trie_summary_v<property_feature>, 0, c, want, classify(),
+                          pred());
+    }
+    constexpr char32_t before(char32_t c, bool want) const {
+        return find_value_before(property_feature::trie(), trie_summary_v<property_feature>, 0, c, want,
+                                 classify(), pred());
+    }
+};
+
+struct category_ranges {
+    std::uint64_t mask;
+    constexpr auto classify() const {
+        const auto m = mask;
+        return [m](std::uint64_t s) {
+            return (s & m) == 0 ? trie_match::none : (s & ~m) == 0 ? trie_match::all : trie_match::some;
+        };
+    }
+    constexpr auto pred() const {
+        const auto m = mask;
+        return [m](std::uint8_t cat) { return ((m >> cat) & 1) != 0; };
+    }
+    constexpr char32_t find(char32_t c, bool want) const {
+        return find_value(category_feature::trie(), trie_summary_v<category_feature>,
+                          static_cast<std::uint32_t>(category::cn), c, want, classify(), pred());
+    }
+    constexpr char32_t before(char32_t c, bool want) const {
+        return find_value_before(category_feature::trie(), trie_summary_v<category_feature>,
+                                 static_cast<std::uint32_t>(category::cn), c, want, classify(), pred());
+    }
+};
+
+struct script_ranges {
+    std::uint8_t sc;
+    constexpr char32_t find(char32_t c, bool want) const {
+        const auto s = sc;
+        return find_value(
+            script_feature::trie(), trie_summary_v<script_feature>, 0, c, want,
+            [s](std::uint16_t v) {
+                return v == script_feature::mixed ? trie_match::some : v == s ? trie_match::all : trie_match::none;
+            },
+            [s](auto record) { return tables::cp_info_records[record].script == s; });
+    }
+};
+
+struct single_range {
+    code_point_range range;
+    constexpr char32_t find(char32_t c, bool want) const {
+        const bool in = c >= range.first && c <= range.last;
+        if(in == want)
+            return c;
+        if(want)
+            return range.first > range.last || c > range.last ? 0x110000 : range.first;
+        return range.last + 1;
+    }
+};
+
+}    // namespace uni::detail
+
+namespace uni {
+
+// View of the [first, last] ranges of code points of a set, in order
+template<typename Source>
+class code_point_ranges {
+public:
+    struct sentinel {};
+    class iterator {
+    public:
+        constexpr code_point_range operator*() const {
+            return m_range;
+        }
+        constexpr iterator& operator++() {
+            next(m_range.last + 1);
+            return *this;
+        }
+        constexpr iterator operator++(int) {
+            auto it = *this;
+            ++*this;
+            return it;
+        }
+        constexpr bool operator==(sentinel) const {
+            return m_range.first > m_range.last;
+        }
+        constexpr bool operator!=(sentinel s) const {
+            return !(*this == s);
+        }
+
+    private:
+        constexpr iterator(Source source, char32_t from) : m_source(source) {
+            next(from);
+        }
+        constexpr void next(char32_t from) {
+            const char32_t first = m_source.find(from, true);
+            if(first > 0x10FFFF) {
+                m_range = {1, 0};
+                return;
+            }
+            m_range = {first, char32_t(m_source.find(first, false) - 1)};
+        }
+
+        Source m_source;
+        code_point_range m_range = {1, 0};
+        friend class code_point_ranges;
+    };
+
+    constexpr explicit code_point_ranges(Source source) : m_source(source) {}
+    constexpr iterator begin() const {
+        return iterator(m_source, 0);
+    }
+    constexpr sentinel end() const {
+        return {};
+    }
+
+private:
+    Source m_source;
+};
+
+constexpr auto ranges_of(property p) {
+    return code_point_ranges(detail::property_ranges{std::uint64_t(1) << static_cast<unsigned>(p)});
+}
+
+constexpr auto ranges_of(category c) {
+    return code_point_ranges(detail::category_ranges{detail::tables::category_mask_bits[static_cast<std::size_t>(c)]});
+}
+
+constexpr auto ranges_of(script s) {
+    return code_point_ranges(detail::script_ranges{static_cast<std::uint8_t>(s)});
+}
+
+constexpr auto ranges_of(block b) {
+    return code_point_ranges(detail::single_range{block_range(b)});
+}
+
+template<auto v>
+constexpr auto ranges_of() {
+    return ranges_of(v);
+}
+
+// Runs: the longest range of code points around cp sharing its value, found in one lookup.
+// A code point past U+10FFFF is a run on its own, with the value of unknown code points.
+namespace detail {
+    // Run of the code points in (in) or out of (!in) the ranges of source
+    template<typename Source>
+    constexpr code_point_range membership_run(Source source, char32_t cp, bool in) {
+        return {source.before(cp, !in), char32_t(source.find(cp, !in) - 1)};
+    }
+}    // namespace detail
+
+constexpr code_point_run<category> cp_category_run(char32_t cp) {
+    const category c = cp_category(cp);
+    if(cp > 0x10FFFF)
+        return {cp, cp, c};
+    const auto r = detail::membership_run(detail::category_ranges{std::uint64_t(1) << static_cast<unsigned>(c)}, cp, true);
+    return {r.first, r.last, c};
+}
+
+constexpr code_point_run<script> cp_script_run(char32_t cp) {
+    if(cp > 0x10FFFF)
+        return {cp, cp, script::unknown};
+    const auto r = detail::tables::script_data.run(cp);
+    return {r.first, char32_t(r.end - 1), static_cast<script>(r.value)};
+}
+
+constexpr code_point_run<version> cp_age_run(char32_t cp) {
+    if(cp > 0x10FFFF)
+        return {cp, cp, version::unassigned};
+    const auto r = detail::tables::age_data.run(cp);
+    return {r.first, char32_t(r.end - 1), static_cast<version>(r.value)};
+}
+
+constexpr code_point_run<block> cp_block_run(char32_t cp) {
+    const block b = cp_block(cp);
+    if(cp > 0x10FFFF)
+        return {cp, cp, b};
+    if(b != block::no_block) {
+        const auto r = block_range(b);
+        return {r.first, r.last, b};
+    }
+    // between two blocks, which are in order of their code points
+    const auto first = std::begin(detail::tables::block_ranges) + 1;
+    const auto last = std::end(detail::tables::block_ranges);
+    const auto next = detail::upper_bound(first, last, cp, [](char32_t c, const code_point_range& r) {
+        return c < r.first;
+    });
+    return {next == first ? 0 : char32_t((next - 1)->last + 1), next == last ? 0x10FFFF : char32_t(next->first - 1), b};
+}
+
+constexpr code_point_run<bool> cp_property_run(property p, char32_t cp) {
+    const bool v = cp_property_is(p, cp);
+    if(cp > 0x10FFFF)
+        return {cp, cp, v};
+    const auto r = detail::membership_run(detail::property_ranges{std::uint64_t(1) << static_cast<unsigned>(p)}, cp, v);
+    return {r.first, r.last, v};
+}
+
+}    // namespace uni
@@ -7,12 +7,8 @@ namespace uni::detail {
 
 
 constexpr binary_prop binary_prop_from_string(std::string_view s) {
-    for(const auto& c : tables::binary_prop_names) {
-        const auto res = propnamecomp(s, c.name);
-        if(res == 0)
-            return binary_prop(c.value);
-    }
-    return binary_prop::unknown;
+    const auto it = tables::binary_prop_names.find(s);
+    return it ? binary_prop(it->value) : binary_prop::unknown;
 }
 
 template<>
@@ -30,6 +26,67 @@ constexpr bool get_binary_prop<binary_prop::any>(char32_t c) {
     return cp_is_valid(c);
 }
 
+constexpr bool cp_has_binary_prop(binary_prop p, char32_t c) {
+    if(p >= binary_prop::unknown)
+        return false;
+    const auto d = tables::binary_prop_descriptors[static_cast<std::size_t>(p)];
+    switch(d.kind) {
+        case binary_prop_kind::property: return cp_property_is(static_cast<property>(d.value), c);
+        case binary_prop_kind::category: return cp_category_in(c, static_cast<category>(d.value));
+        case binary_prop_kind::script: return cp_script(c) == static_cast<script>(d.value);
+        case binary_prop_kind::script_extensions:
+            return cp_script_extensions(c).contains(static_cast<script>(d.value));
+        case binary_prop_kind::any: return cp_is_valid(c);
+        case binary_prop_kind::ascii: return cp_is_ascii(c);
+        case binary_prop_kind::assigned: return cp_is_assigned(c);
+    }
+    return false;
+}
+
+// Batch lookup of the values of some property, by chunks, then test of these values
+template<typename T, typename Lookup, typename Test>
+void batch_test(const char32_t* first, const char32_t* last, bool* out, Lookup lookup, Test test) {
+    T values[256];
+    while(first != last) {
+        const auto n = std::min(std::size_t(last - first), std::size(values));
+        lookup(first, first + n, values);
+        for(std::size_t i = 0; i < n; i++)
+            out[i] = test(values[i]);
+        first += n;
+        out += n;
+    }
+}
+
+// The kind of the property is looked up once per batch
+inline void cp_has_binary_prop(binary_prop p, const char32_t* first, const char32_t* last, bool* out) {
+    if(p >= binary_prop::unknown) {
+        std::fill(out, out + (last - first), false);
+        return;
+    }
+    const auto d = tables::binary_prop_descriptors[static_cast<std::size_t>(p)];
+    switch(d.kind) {
+        case binary_prop_kind::property:
+            cp_property_is(static_cast<property>(d.value), first, last, out);
+            return;
+        case binary_prop_kind::category: {
+            const category_mask mask(static_cast<category>(d.value));
+            batch_test<category>(first, last, out, [](auto... args) { cp_category(args...); },
+                                 [mask](category c) { return mask.contains(c); });
+            return;
+        }
+        case binary_prop_kind::script: {
+            const auto sc = static_cast<script>(d.value);
+            batch_test<script>(first, last, out, [](auto... args) { cp_script(args...); },
+                               [sc](script s) { return s == sc; });
+            return;
+        }
+        default:
+            for(; first != last; ++first, ++out)
+                *out = cp_has_binary_prop(p, *first);
+            return;
+    }
+}
+
 constexpr bool is_unknown(binary_prop s)
 {
     return s == binary_prop::unknown;
@@ -0,0 +1,216 @@
+#pragma once
+#include <cstddef>
+#include "cedilla/ranges.h"
+
+// Sets of code points combined at compile time.
+// set_of<property::alphabetic>() - set_of<script::latn>() is folded into a single table,
+// computed at compile time from the ranges of its operands.
+
+namespace uni::detail {
+
+// Operands of a set expression: for_each_bound calls f with the bounds of the ranges of the set,
+// in order, each range [b0, b1) starting at an even bound and ending at the next one.
+template<auto v>
+struct set_leaf {
+    template<typename F>
+    static constexpr void for_each_bound(F f) {
+        for(const auto r : ranges_of(v)) {
+            f(r.first);
+            f(r.last + 1);
+        }
+    }
+};
+
+// The bounds of a set, computed once per set expression
+template<std::size_t N>
+struct set_bounds {
+    // one more element so that empty sets have storage
+    char32_t data[N + 1];
+};
+
+template<typename Expr>
+constexpr std::size_t set_bounds_count() {
+    std::size_t n = 0;
+    Expr::for_each_bound([&n](char32_t) { n++; });
+    return n;
+}
+
+template<typename Expr>
+struct set_data {
+    static constexpr std::size_t size = set_bounds_count<Expr>();
+    static constexpr set_bounds<size> bounds = [] {
+        set_bounds<size> b{};
+        std::size_t i = 0;
+        Expr::for_each_bound([&](char32_t c) { b.data[i++] = c; });
+        return b;
+    }();
+};
+
+// Merges the bounds of two sets, a code point is in the result if op(in a, in b)
+template<typename A, typename B, typename Op>
+struct set_op {
+    template<typename F>
+    static constexpr void for_each_bound(F f) {
+        const auto& a = set_data<A>::bounds.data;
+        const auto& b = set_data<B>::bounds.data;
+        constexpr std::size_t na = set_data<A>::size;
+        constexpr std::size_t nb = set_data<B>::size;
+        std::size_t i = 0;
+        std::size_t j = 0;
+        bool in = false;
+        while(i < na || j < nb) {
+            const char32_t c = j == nb || (i < na && a[i] < b[j]) ? a[i] : b[j];
+            i += i < na && a[i] == c;
+            j += j < nb && b[j] == c;
+            const bool v = Op{}(i % 2 == 1, j % 2 == 1);
+            if(v != in)
+                f(c);
+            in = v;
+        }
+    }
+};
+
+struct set_all {
+    template<typename F>
+    static constexpr void for_each_bound(F f) {
+        f(0);
+        f(0x110000);
+    }
+};
+
+struct set_or {
+    constexpr bool operator()(bool a, bool b) const {
+        return a || b;
+    }
+};
+struct set_and {
+    constexpr bool operator()(bool a, bool b) const {
+        return a && b;
+    }
+};
+struct set_minus {
+    constexpr bool operator()(bool a, bool b) const {
+        return a && !b;
+    }
+};
+
+// The lookup table of a set, a trie of bitmaps: blocks of 1024 code points select
+// 16 chunks of 64 bits. Blocks and chunks that hold a single value all share the first two
+// blocks and chunks, which are empty and full, so the size depends on the number of ranges.
+template<std::size_t blocks_s, std::size_t chunks_s>
+struct set_table {
+    std::uint16_t index[0x110000 >> 10];
+    std::uint16_t blocks[blocks_s * 16];
+    std::uint64_t chunks[chunks_s];
+
+    constexpr bool lookup(char32_t c) const {
+        if(c > 0x10FFFF)
+            return false;
+        const std::size_t chunk = blocks[std::size_t(index[c >> 10]) * 16 + ((c >> 6) & 15)];
+        return (chunks[chunk] >> (c & 63)) & 1;
+    }
+};
+
+// Number of distinct values of c >> bits among the bounds that are not aligned on 1 << bits
+constexpr std::size_t unaligned_bounds_count(const char32_t* bounds, std::size_t n, unsigned bits) {
+    std::size_t count = 0;
+    std::size_t last = std::size_t(-1);
+    for(std::size_t i = 0; i < n; i++) {
+        const std::size_t k = bounds[i] >> bits;
+        if((bounds[i] & ((1u << bits) - 1)) != 0 && k != last) {
+            count++;
+            last = k;
+        }
+    }
+    return count;
+}
+
+template<typename Expr>
+constexpr auto make_set_table() {
+    constexpr std::size_t n = set_data<Expr>::size;
+    constexpr const auto& bounds = set_data<Expr>::bounds.data;
+    constexpr std::size_t blocks_s = 2 + unaligned_bounds_count(bounds, n, 10);
+    constexpr std::size_t chunks_s = 2 + unaligned_bounds_count(bounds, n, 6);
+    static_assert(chunks_s <= 0x10000);
+    set_table<blocks_s, chunks_s> t{};
+    for(std::size_t i = 0; i < 16; i++)
+        t.blocks[16 + i] = 1;
+    t.chunks[1] = ~std::uint64_t(0);
+
+    // bounds[i] is the first bound after the code point being looked at,
+    // which is in the set if i is odd
+    std::size_t i = 0;
+    std::size_t block = 2;
+    std::size_t chunk = 2;
+    for(std::size_t b = 0; b < (0x110000 >> 10); b++) {
+        const char32_t first = char32_t(b << 10);
+        while(i < n && bounds[i] <= first)
+            i++;
+        if(i == n || bounds[i] >= first + 1024) {
+            t.index[b] = i % 2;
+            continue;
+        }
+        t.index[b] = static_cast<std::uint16_t>(block);
+        for(std::size_t k = 0; k < 16; k++) {
+            const char32_t c = first + char32_t(k << 6);
+            while(i < n && bounds[i] <= c)
+                i++;
+            if(i == n || bounds[i] >= c + 64) {
+                t.blocks[block * 16 + k] = i % 2;
+                continue;
+            }
+            t.blocks[block * 16 + k] = static_cast<std::uint16_t>(chunk);
+            // each bound flips the bits that follow it
+            std::uint64_t bits = i % 2 ? ~std::uint64_t(0) : 0;
+            for(; i < n && bounds[i] < c + 64; i++)
+                bits ^= ~std::uint64_t(0) << (bounds[i] - c);
+            t.chunks[chunk++] = bits;
+        }
+        block++;
+    }
+    return t;
+}
+
+template<typename Expr>
+inline constexpr auto set_table_v = make_set_table<Expr>();
+
+}    // namespace uni::detail
+
+namespace uni {
+
+template<typename Expr>
+struct code_point_set {
+    constexpr bool contains(char32_t c) const {
+        return detail::set_table_v<Expr>.lookup(c);
+    }
+    constexpr bool operator()(char32_t c) const {
+        return contains(c);
+    }
+};
+
+template<auto v>
+constexpr auto set_of() {
+    return code_point_set<detail::set_leaf<v>>{};
+}
+
+template<typename A, typename B>
+constexpr code_point_set<detail::set_op<A, B, detail::set_or>> operator|(code_point_set<A>, code_point_set<B>) {
+    return {};
+}
+
+template<typename A, typename B>
+constexpr code_point_set<detail::set_op<A, B, detail::set_and>> operator&(code_point_set<A>, code_point_set<B>) {
+    return {};
+}
+
+template<typename A, typename B>
+constexpr code_point_set<detail::set_op<A, B, detail::set_minus>> operator-(code_point_set<A>, code_point_set<B>) {
+    return {};
+}
+
+template<typename A>
+constexpr code_point_set<detail::set_op<detail::set_all, A, detail::set_minus>> operator~(code_point_set<A>) {
+    return {};
+}
+
+}    // namespace uni
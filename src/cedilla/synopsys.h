@@ -1,4 +1,5 @@
 #pragma once
+#include <cstdint>
 #include <string_view>
 
 #ifndef CTRE_UNICODE_SYNOPSYS_WAS_INCLUDED
@@ -9,34 +10,92 @@ namespace uni
     enum class version : unsigned char;
     enum class script ;
     enum class block;
+    enum class numeric_type;
 
-    struct script_extensions_view {
-        constexpr script_extensions_view(char32_t);
+    // How the generator picked the representation of each table, tables_policy tells which.
+    // minimal favors size, latency avoids binary searches, balanced is in between.
+    // All of them provide the same functions.
+    enum class table_policy { minimal, balanced, latency };
+
+    namespace detail {
+        struct code_point_record;
+    }
 
+    // Set of scripts, such as the Script_Extensions of a code point
+    struct script_set {
         struct sentinel {};
         struct iterator {
-
-            constexpr iterator(char32_t c);
             constexpr script operator*() const;
-
-            constexpr iterator& operator++(int);
-
-            constexpr iterator operator++();
-
+            constexpr iterator& operator++();
+            constexpr iterator operator++(int);
             constexpr bool operator==(sentinel) const;
             constexpr bool operator!=(sentinel) const;
 
         private:
-            char32_t m_c;
-            script m_script;
-            int idx = 1;
+            constexpr iterator(const std::uint64_t (&bits)[4]);
+            constexpr void skip_empty_words();
+
+            std::uint64_t m_bits[4];
+            std::size_t m_word = 0;
+            friend struct script_set;
         };
 
+        constexpr script_set() = default;
+        constexpr script_set(script s);
+
+        constexpr bool contains(script s) const;
+        constexpr bool empty() const;
+        constexpr std::size_t count() const;
+
+        // scripts in the order of the enum
+        constexpr iterator begin() const;
+        constexpr sentinel end() const;
+
+        friend constexpr script_set operator|(script_set a, script_set b);
+        friend constexpr script_set operator&(script_set a, script_set b);
+        friend constexpr bool operator==(script_set a, script_set b);
+        friend constexpr bool operator!=(script_set a, script_set b);
+
+    private:
+        // script values fit in 8 bits
+        std::uint64_t _bits[4] = {};
+        friend struct script_extensions_view;
+    };
+
+    struct script_extensions_view {
+        constexpr script_extensions_view(char32_t);
+
+        using sentinel = script_set::sentinel;
+        using iterator = script_set::iterator;
+
         constexpr iterator begin() const;
         constexpr sentinel end() const;
+        constexpr bool contains(script s) const;
+        constexpr script_set scripts() const;
 
         private:
-            char32_t c;
+            script_set m_scripts;
+    };
+
+    // Set of code points combined at compile time from properties, categories, scripts and blocks,
+    // such as set_of<property::alphabetic>() - set_of<script::latn>()
+    template<typename Expr>
+    struct code_point_set;
+    template<auto v>
+    constexpr auto set_of();
+
+    // Inclusive range of code points, empty when first > last
+    struct code_point_range {
+        char32_t first;
+        char32_t last;
+    };
+
+    // Range [first, last] of code points sharing a value
+    template<typename T>
+    struct code_point_run {
+        char32_t first;
+        char32_t last;
+        T value;
     };
 
     struct numeric_value {
@@ -45,25 +104,117 @@ namespace uni
         constexpr long long numerator() const;
         constexpr int denominator() const;
         constexpr bool is_valid() const;
+        constexpr uni::numeric_type type() const;
 
     protected:
         constexpr numeric_value() = default;
-        constexpr numeric_value(long long n, int16_t d);
+        constexpr numeric_value(long long n, int16_t d, std::uint8_t type);
 
         long long _n = 0;
         int16_t _d = 0;
+        std::uint8_t _type = 0;
         friend constexpr numeric_value cp_numeric_value(char32_t cp);
     };
 
+    struct category_mask {
+        constexpr category_mask() = default;
+        constexpr category_mask(category c);
+
+        constexpr bool contains(category c) const;
+        constexpr bool empty() const;
+
+        friend constexpr category_mask operator|(category_mask a, category_mask b);
+        friend constexpr category_mask operator&(category_mask a, category_mask b);
+        friend constexpr bool operator==(category_mask a, category_mask b);
+        friend constexpr bool operator!=(category_mask a, category_mask b);
+
+    private:
+        std::uint64_t _bits = 0;
+        friend constexpr bool cp_category_in(char32_t cp, category_mask mask);
+    };
+
+    struct code_point_info {
+        constexpr uni::category category() const;
+        constexpr uni::script script() const;
+        constexpr uni::block block() const;
+        constexpr uni::version age() const;
+        constexpr uni::numeric_type numeric_type() const;
+        // Code points with the same script extensions have the same id
+        constexpr std::uint8_t script_extensions_id() const;
+
+    private:
+        constexpr code_point_info(const detail::code_point_record& r);
+
+        std::uint8_t _category;
+        std::uint8_t _script;
+        std::uint16_t _block;
+        std::uint8_t _age;
+        std::uint8_t _numeric_type;
+        std::uint8_t _script_extensions;
+        friend constexpr code_point_info cp_info(char32_t cp);
+    };
+
+    struct property_set {
+        constexpr property_set() = default;
+        constexpr property_set(property p);
+
+        constexpr bool contains(property p) const;
+        constexpr bool empty() const;
+        constexpr std::size_t count() const;
+
+        friend constexpr property_set operator|(property_set a, property_set b);
+        friend constexpr property_set operator&(property_set a, property_set b);
+        friend constexpr bool operator==(property_set a, property_set b);
+        friend constexpr bool operator!=(property_set a, property_set b);
+
+    private:
+        std::uint64_t _bits = 0;
+        friend constexpr property_set cp_properties(char32_t cp);
+    };
+
+    constexpr property_set operator|(property_set a, property_set b);
+    constexpr property_set operator|(property a, property b);
+    constexpr property_set operator&(property_set a, property_set b);
+    constexpr bool operator==(property_set a, property_set b);
+    constexpr bool operator!=(property_set a, property_set b);
+
+    constexpr script_set operator|(script_set a, script_set b);
+    constexpr script_set operator|(script a, script b);
+    constexpr script_set operator&(script_set a, script_set b);
+    constexpr bool operator==(script_set a, script_set b);
+    constexpr bool operator!=(script_set a, script_set b);
+
+    constexpr category_mask operator|(category_mask a, category_mask b);
+    constexpr category_mask operator|(category a, category b);
+    constexpr category_mask operator&(category_mask a, category_mask b);
+    constexpr bool operator==(category_mask a, category_mask b);
+    constexpr bool operator!=(category_mask a, category_mask b);
+
     constexpr category cp_category(char32_t cp);
     constexpr script cp_script(char32_t cp);
     constexpr script_extensions_view cp_script_extensions(char32_t cp);
     constexpr version cp_age(char32_t cp);
     constexpr block cp_block(char32_t cp);
+    constexpr code_point_range block_range(block b);
+
+    // Views of the ranges of code points of a property, category, script or block, in order
+    constexpr auto ranges_of(property p);
+    constexpr auto ranges_of(category c);
+    constexpr auto ranges_of(script s);
+    constexpr auto ranges_of(block b);
+    // Run of code points around cp sharing its category, script, age, block or property
+    constexpr code_point_run<category> cp_category_run(char32_t cp);
+    constexpr code_point_run<script> cp_script_run(char32_t cp);
+    constexpr code_point_run<version> cp_age_run(char32_t cp);
+    constexpr code_point_run<block> cp_block_run(char32_t cp);
+    constexpr code_point_run<bool> cp_property_run(property p, char32_t cp);
     constexpr bool cp_is_valid(char32_t cp);
     constexpr bool cp_is_assigned(char32_t cp);
     constexpr bool cp_is_ascii(char32_t cp);
     constexpr numeric_value cp_numeric_value(char32_t cp);
+    constexpr code_point_info cp_info(char32_t cp);
+    constexpr property_set cp_properties(char32_t cp);
+    constexpr bool cp_property_is(property p, char32_t cp);
 
     template<script>
     constexpr bool cp_script_is(char32_t);
@@ -71,15 +222,39 @@ namespace uni
     constexpr bool cp_property_is(char32_t);
     template<category>
     constexpr bool cp_category_is(char32_t);
+    // Lookup of the code point at the start of the UTF-8 sequence s of len bytes,
+    // without decoding it first. Char is char, unsigned char or char8_t
+    template<property, typename Char>
+    constexpr bool cp_property_is_utf8(const Char* s, std::size_t len);
+    constexpr bool cp_category_in(char32_t cp, category_mask mask);
+
+    // Batch lookups, out must have room for last - first elements
+    void cp_category(const char32_t* first, const char32_t* last, category* out);
+    void cp_script(const char32_t* first, const char32_t* last, script* out);
+    template<property>
+    void cp_property_is(const char32_t* first, const char32_t* last, bool* out);
+    void cp_property_is(property p, const char32_t* first, const char32_t* last, bool* out);
+
+    // Instruction sets of the batch lookups, chosen at startup among those of the host.
+    // set_batch_simd_level forces a lower one, it returns false for those the host lacks.
+    enum class simd_level { scalar, sse42, avx2, avx512 };
+    simd_level host_simd_level();
+    simd_level batch_simd_level();
+    bool set_batch_simd_level(simd_level level);
+
+    // Lookups of sequential text remembering the last range of each table, see cursor.h
+    class lookup_cursor;
 
     namespace detail
     {
         enum class binary_prop;
-        constexpr int propnamecomp(std::string_view sa, std::string_view sb);
+        constexpr bool propnameeq(std::string_view sa, std::string_view sb);
         constexpr binary_prop binary_prop_from_string(std::string_view s);
 
         template<binary_prop p>
         constexpr bool get_binary_prop(char32_t) = delete;
+        constexpr bool cp_has_binary_prop(binary_prop p, char32_t c);
+        void cp_has_binary_prop(binary_prop p, const char32_t* first, const char32_t* last, bool* out);
 
         constexpr script   script_from_string(std::string_view s);
         constexpr block    block_from_string(std::string_view s);
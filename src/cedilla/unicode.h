@@ -6,45 +6,71 @@
 namespace uni {
 
 constexpr category cp_category(char32_t cp) {
+    if(cp <= 0xFF)
+        return static_cast<category>(detail::tables::latin1_data[cp].category);
     if(cp > 0x10FFFF)
         return category::unassigned;
     return detail::tables::get_category(cp);
 }
 
+constexpr category_mask::category_mask(category c)
+    : _bits(detail::tables::category_mask_bits[static_cast<std::size_t>(c)]) {}
+
+constexpr bool category_mask::contains(category c) const {
+    const auto bits = category_mask(c)._bits;
+    return (_bits & bits) == bits;
+}
+
+constexpr bool category_mask::empty() const {
+    return _bits == 0;
+}
+
+constexpr category_mask operator|(category_mask a, category_mask b) {
+    category_mask m;
+    m._bits = a._bits | b._bits;
+    return m;
+}
+
+constexpr category_mask operator|(category a, category b) {
+    return category_mask(a) | category_mask(b);
+}
+
+constexpr category_mask operator&(category_mask a, category_mask b) {
+    category_mask m;
+    m._bits = a._bits & b._bits;
+    return m;
+}
+
+constexpr bool operator==(category_mask a, category_mask b) {
+    return a._bits == b._bits;
+}
+
+constexpr bool operator!=(category_mask a, category_mask b) {
+    return a._bits != b._bits;
+}
+
+constexpr bool cp_category_in(char32_t cp, category_mask mask) {
+    return (mask._bits >> static_cast<unsigned>(cp_category(cp))) & 1;
+}
+
 constexpr uni::version detail::age_from_string(std::string_view a) {
-    for(std::size_t i = 0; i < std::size(detail::tables::age_strings); ++i) {
-        const auto res = detail::propnamecomp(a, detail::tables::age_strings[i]);
-        if(res == 0)
-            return uni::version(i);
-    }
-    return uni::version::unassigned;
+    const auto it = detail::tables::age_names.find(a);
+    return it ? uni::version(it->value) : uni::version::unassigned;
 }
 
 constexpr category detail::category_from_string(std::string_view s) {
-    for(const auto& c : detail::tables::categories_names) {
-        const auto res = detail::propnamecomp(s, c.name);
-        if(res == 0)
-            return category(c.value);
-    }
-    return category::unassigned;
+    const auto it = detail::tables::categories_names.find(s);
+    return it ? category(it->value) : category::unassigned;
 }
 
 constexpr block detail::block_from_string(std::string_view s) {
-    for(const auto& c : detail::tables::blocks_names) {
-        const auto res = detail::propnamecomp(s, c.name);
-        if(res == 0)
-            return block(c.value);
-    }
-    return block::no_block;
+    const auto it = detail::tables::blocks_names.find(s);
+    return it ? block(it->value) : block::no_block;
 }
 
 constexpr script detail::script_from_string(std::string_view s) {
-    for(const auto& c : detail::tables::scripts_names) {
-        const auto res = detail::propnamecomp(s, c.name);
-        if(res == 0)
-            return script(c.value);
-    }
-    return script::unknown;
+    const auto it = detail::tables::scripts_names.find(s);
+    return it ? script(it->value) : script::unknown;
 }
 
 constexpr bool detail::is_unassigned(category cat)
@@ -67,130 +93,220 @@ constexpr bool detail::is_unassigned(version v)
 }
 
 constexpr script cp_script(char32_t cp) {
-    return detail::tables::cp_script<0>(cp);
+    if(cp <= 0xFF)
+        return static_cast<script>(detail::tables::latin1_data[cp].script);
+    return detail::tables::get_script(cp);
+}
+
+constexpr script_set::script_set(script s) {
+    const auto idx = static_cast<std::size_t>(s);
+    _bits[idx / 64] = std::uint64_t(1) << (idx % 64);
+}
+
+constexpr bool script_set::contains(script s) const {
+    const auto idx = static_cast<std::size_t>(s);
+    return (_bits[idx / 64] >> (idx % 64)) & 1;
+}
+
+constexpr bool script_set::empty() const {
+    return (_bits[0] | _bits[1] | _bits[2] | _bits[3]) == 0;
+}
+
+constexpr std::size_t script_set::count() const {
+    std::size_t n = 0;
+    for(auto bits : _bits) {
+        for(; bits != 0; bits &= bits - 1)
+            n++;
+    }
+    return n;
+}
+
+constexpr script_set::iterator script_set::begin() const {
+    return iterator(_bits);
+}
+
+constexpr script_set::sentinel script_set::end() const {
+    return {};
+}
+
+constexpr script_set operator|(script_set a, script_set b) {
+    for(std::size_t i = 0; i < 4; i++)
+        a._bits[i] |= b._bits[i];
+    return a;
 }
 
-constexpr script_extensions_view::script_extensions_view(char32_t c_) : c(c_){}
+constexpr script_set operator|(script a, script b) {
+    return script_set(a) | script_set(b);
+}
 
-constexpr script_extensions_view::iterator::iterator(char32_t c_) : m_c(c_), m_script(detail::tables::get_cp_script(m_c, 1)) {
-    if(m_script == script::unknown)
-        m_script = detail::tables::cp_script<0>(m_c);
+constexpr script_set operator&(script_set a, script_set b) {
+    for(std::size_t i = 0; i < 4; i++)
+        a._bits[i] &= b._bits[i];
+    return a;
+}
+
+constexpr bool operator==(script_set a, script_set b) {
+    for(std::size_t i = 0; i < 4; i++) {
+        if(a._bits[i] != b._bits[i])
+            return false;
     }
+    return true;
+}
+
+constexpr bool operator!=(script_set a, script_set b) {
+    return !(a == b);
+}
+
+constexpr script_set::iterator::iterator(const std::uint64_t (&bits)[4])
+    : m_bits{bits[0], bits[1], bits[2], bits[3]} {
+    skip_empty_words();
+}
+
+constexpr void script_set::iterator::skip_empty_words() {
+    while(m_word < 4 && m_bits[m_word] == 0)
+        m_word++;
+}
 
-constexpr script script_extensions_view::iterator::operator*() const {
-    return m_script;
+constexpr script script_set::iterator::operator*() const {
+    return static_cast<script>(64 * m_word + detail::countr_zero(m_bits[m_word]));
 }
 
-constexpr auto script_extensions_view::iterator::operator++(int) ->iterator & {
-    idx++;
-    m_script = detail::tables::get_cp_script(m_c, idx);
+constexpr auto script_set::iterator::operator++() -> iterator& {
+    m_bits[m_word] &= m_bits[m_word] - 1;
+    skip_empty_words();
     return *this;
 }
 
-constexpr auto script_extensions_view::iterator::operator++()  -> iterator {
+constexpr auto script_set::iterator::operator++(int) -> iterator {
     auto c = *this;
-    idx++;
-    m_script = detail::tables::get_cp_script(m_c, idx);
+    ++*this;
     return c;
 }
 
-constexpr bool script_extensions_view::iterator::operator==(sentinel) const {
-    return m_script == script::unknown;
+constexpr bool script_set::iterator::operator==(sentinel) const {
+    return m_word == 4;
 }
 
-constexpr bool script_extensions_view::iterator::operator!=(sentinel) const {
-    return m_script != script::unknown;
+constexpr bool script_set::iterator::operator!=(sentinel) const {
+    return m_word != 4;
 }
 
-/*constexpr bool script_extensions_view::iterator::operator==(iterator it) const {
-    return m_script == it.m_script && m_c == it.m_c;
-};
-constexpr bool script_extensions_view::iterator::operator!=(iterator it) const {
-    return !(*this == it);
-};*/
+constexpr script_extensions_view::script_extensions_view(char32_t c) {
+    const auto& bits = detail::tables::script_set_bits[cp_info(c).script_extensions_id()];
+    for(std::size_t i = 0; i < 4; i++)
+        m_scripts._bits[i] = bits[i];
+}
 
 constexpr script_extensions_view::iterator script_extensions_view::begin() const {
-    return iterator{c};
+    return m_scripts.begin();
 }
+
 constexpr script_extensions_view::sentinel script_extensions_view::end() const {
     return {};
 }
 
+constexpr bool script_extensions_view::contains(script s) const {
+    return m_scripts.contains(s);
+}
+
+constexpr script_set script_extensions_view::scripts() const {
+    return m_scripts;
+}
+
 constexpr script_extensions_view cp_script_extensions(char32_t cp) {
     return script_extensions_view(cp);
 }
 
 
 constexpr version cp_age(char32_t cp) {
-    return static_cast<version>(detail::tables::age_data.value(cp, uint8_t(version::unassigned)));
+    if(cp <= 0xFF)
+        return static_cast<version>(detail::tables::latin1_data[cp].age);
+    return detail::tables::get_age(cp);
 }
 
 constexpr block cp_block(char32_t cp) {
-    const auto end = std::end(detail::tables::block_data._data);
-    auto it = detail::upper_bound(std::begin(detail::tables::block_data._data), end, cp, [](char32_t cp_, uint32_t v) {
-        char32_t c = (v >> 8);
-        return cp_ < c;
-    });
-    if(it == end)
-        return block::no_block;
-    it--;
-    auto offset = (*it) & 0xFF;
-    if(offset == 0)
-        return block::no_block;
-    offset--;
+    if(cp <= 0xFF)
+        return static_cast<block>(detail::tables::latin1_data[cp].block);
+    return static_cast<block>(detail::tables::block_data.lookup(cp >> 4, 0));
+}
+
+constexpr code_point_range block_range(block b) {
+    const auto idx = static_cast<std::size_t>(b);
+    if(idx >= std::size(detail::tables::block_ranges))
+        return {1, 0};
+    return detail::tables::block_ranges[idx];
+}
+
+static_assert(static_cast<unsigned>(property::max) < 64);
+
+constexpr property_set::property_set(property p) : _bits(std::uint64_t(1) << static_cast<unsigned>(p)) {}
+
+constexpr bool property_set::contains(property p) const {
+    return (_bits >> static_cast<unsigned>(p)) & 1;
+}
+
+constexpr bool property_set::empty() const {
+    return _bits == 0;
+}
 
-    const auto d = std::distance(std::begin(detail::tables::block_data._data), it);
-    return uni::block((d - offset) + 1);
+constexpr std::size_t property_set::count() const {
+    std::size_t n = 0;
+    for(auto bits = _bits; bits != 0; bits &= bits - 1)
+        n++;
+    return n;
 }
 
-template<>
-constexpr bool cp_property_is<property::noncharacter_code_point>(char32_t cp) {
-    return (char32_t(cp) & 0xfffe) == 0xfffe || (char32_t(cp) >= 0xfdd0 && char32_t(cp) <= 0xfdef);
+constexpr property_set operator|(property_set a, property_set b) {
+    property_set s;
+    s._bits = a._bits | b._bits;
+    return s;
 }
 
-// http://unicode.org/reports/tr44/#Lowercase
-template<>
-constexpr bool cp_property_is<property::lowercase>(char32_t cp) {
-    return detail::tables::cat_ll.lookup(char32_t(cp)) || detail::tables::prop_olower_data.lookup(char32_t(cp));
+constexpr property_set operator|(property a, property b) {
+    return property_set(a) | property_set(b);
 }
 
-// http://unicode.org/reports/tr44/#Uppercase
-template<>
-constexpr bool cp_property_is<property::uppercase>(char32_t cp) {
-    return detail::tables::cat_lu.lookup(char32_t(cp)) || detail::tables::prop_oupper_data.lookup(char32_t(cp));
+constexpr property_set operator&(property_set a, property_set b) {
+    property_set s;
+    s._bits = a._bits & b._bits;
+    return s;
 }
 
-// http://unicode.org/reports/tr44/#Cased
-template<>
-constexpr bool cp_property_is<property::cased>(char32_t cp) {
-    return cp_property_is<property::lower>(cp) || cp_property_is<property::upper>(cp) ||
-           detail::tables::cat_lt.lookup(char32_t(cp));
+constexpr bool operator==(property_set a, property_set b) {
+    return a._bits == b._bits;
 }
 
-// http://unicode.org/reports/tr44/#Math
-template<>
-constexpr bool cp_property_is<property::math>(char32_t cp) {
-    return detail::tables::cat_sm.lookup(char32_t(cp)) || detail::tables::prop_omath_data.lookup(cp);
+constexpr bool operator!=(property_set a, property_set b) {
+    return a._bits != b._bits;
 }
 
-// http://unicode.org/reports/tr44/#Case_Ignorable
-template<>
-constexpr bool cp_property_is<property::case_ignorable>(char32_t) {
-    return false;
+constexpr property_set cp_properties(char32_t cp) {
+    property_set s;
+    if(cp <= 0xFF)
+        s._bits = detail::tables::latin1_data[cp].properties;
+    else
+        s._bits = detail::tables::property_rows[detail::tables::property_data.lookup(cp, 0)];
+    return s;
 }
 
+constexpr bool cp_property_is(property p, char32_t cp) {
+    return cp_properties(cp).contains(p);
+}
 
-// http://unicode.org/reports/tr44/#Grapheme_Extend
-template<>
-constexpr bool cp_property_is<property::grapheme_extend>(char32_t cp) {
-    return detail::tables::cat_me.lookup(char32_t(cp)) || detail::tables::cat_mn.lookup(char32_t(cp)) ||
-           detail::tables::prop_ogr_ext_data.lookup(cp);
+template<property p, typename Char>
+constexpr bool cp_property_is_utf8(const Char* s, std::size_t len) {
+    const auto row = len != 0 && detail::utf8_byte(s, 0) < 0x80
+                         ? detail::tables::latin1_data[detail::utf8_byte(s, 0)].properties
+                         : detail::tables::property_rows[detail::tables::property_data.lookup_utf8(s, len, 0)];
+    return (row >> static_cast<unsigned>(p)) & 1;
 }
 
 constexpr bool cp_is_valid(char32_t cp) {
     return char32_t(cp) <= 0x10FFFF;
 }
 constexpr bool cp_is_assigned(char32_t cp) {
+    if(cp <= 0xFF)
+        return detail::tables::latin1_data[cp].category != std::uint8_t(category::cn);
     return detail::tables::prop_assigned.lookup(char32_t(cp));
 }
 
@@ -198,74 +314,47 @@ constexpr bool cp_is_ascii(char32_t cp) {
     return char32_t(cp) <= 0x7F;
 }
 
-template<>
-constexpr bool cp_property_is<property::default_ignorable_code_point>(char32_t cp) {
-    const auto c = char32_t(cp);
-    const bool maybe = detail::tables::prop_odi_data.lookup(cp) || detail::tables::cat_cf.lookup(cp) ||
-                       detail::tables::prop_vs_data.lookup(cp);
-    if(!maybe)
-        return false;
-    // ignore (Interlinear annotation format characters
-    if(c >= 0xFFF9 && c <= 0xFFFB) {
-        return false;
-    }
-    // Ignore Egyptian hieroglyph format characters
-    else if(c >= 0x13430 && c <= 0x13438) {
-        return false;
-    } else if(detail::tables::prop_wspace_data.lookup(cp))
-        return false;
-    else if(detail::tables::prop_pcm_data.lookup(cp))
-        return false;
-    return true;
+constexpr code_point_info::code_point_info(const detail::code_point_record& r)
+    : _category(r.category), _script(r.script), _block(r.block), _age(r.age),
+      _numeric_type(r.numeric_type), _script_extensions(r.script_extensions) {}
+
+constexpr category code_point_info::category() const {
+    return static_cast<uni::category>(_category);
 }
 
-// http://www.unicode.org/reports/tr31/#D1
-template<>
-constexpr bool cp_property_is<property::id_start>(char32_t cp) {
-    const bool maybe =
-        cp_category_is<category::letter>(cp) || detail::tables::cat_nl.lookup(cp) || detail::tables::prop_oids_data.lookup(cp);
-    if(!maybe)
-        return false;
-    return !detail::tables::prop_pat_syn_data.lookup(cp) && !detail::tables::prop_pat_ws_data.lookup(cp);
+constexpr script code_point_info::script() const {
+    return static_cast<uni::script>(_script);
 }
 
-template<>
-constexpr bool cp_property_is<property::id_continue>(char32_t cp) {
-    const bool maybe = cp_category_is<category::letter>(cp) || detail::tables::cat_nl.lookup(cp) ||
-                       detail::tables::prop_oids_data.lookup(cp) || detail::tables::cat_mn.lookup(cp) || detail::tables::cat_mc.lookup(cp) ||
-                       detail::tables::cat_nd.lookup(cp) || detail::tables::cat_pc.lookup(cp) || detail::tables::prop_oidc_data.lookup(cp);
-    if(!maybe)
-        return false;
-    return !detail::tables::prop_pat_syn_data.lookup(cp) && !detail::tables::prop_pat_ws_data.lookup(cp);
+constexpr block code_point_info::block() const {
+    return static_cast<uni::block>(_block);
 }
 
-namespace detail {
+constexpr version code_point_info::age() const {
+    return static_cast<version>(_age);
+}
 
-template<typename Array, typename Res = long long>
-constexpr bool get_numeric_value(char32_t cp, const Array& array, Res& res) {
-    auto it = detail::lower_bound(std::begin(array), std::end(array), cp,
-                               [](const auto& d, char32_t cp_) { return d.first < cp_; });
-    if(it == std::end(array) || it->first != cp)
-        return false;
-    res = it->second;
-    return true;
+constexpr numeric_type code_point_info::numeric_type() const {
+    return static_cast<uni::numeric_type>(_numeric_type);
+}
+
+constexpr std::uint8_t code_point_info::script_extensions_id() const {
+    return _script_extensions;
 }
 
+constexpr code_point_info cp_info(char32_t cp) {
+    if(cp <= 0xFF)
+        return code_point_info(detail::tables::cp_info_records[detail::tables::latin1_data[cp].info]);
+    return code_point_info(detail::tables::cp_info_records[detail::tables::cp_info_data.lookup(cp, 0)]);
 }
 
 constexpr numeric_value cp_numeric_value(char32_t cp) {
-    long long res = 0;
-    if(!(detail::get_numeric_value(cp, detail::tables::numeric_data64, res) ||
-             detail::get_numeric_value(cp, detail::tables::numeric_data32, res) ||
-             detail::get_numeric_value(cp, detail::tables::numeric_data16, res) || [&res, cp]() -> bool {
-           res = detail::tables::numeric_data8.value(cp, 255);
-           return res != 255;
-       }())) {
-        return {};
-    }
-    int16_t d = 1;
-    detail::get_numeric_value(cp, detail::tables::numeric_data_d, d);
-    return numeric_value(res, d);
+    // numeric_records[0] is the record of code points without a numeric value
+    std::size_t idx = 0;
+    if(cp <= 0x10FFFF && ((detail::tables::numeric_pages[cp >> 14] >> ((cp >> 8) & 63)) & 1))
+        idx = detail::tables::numeric_data.lookup(cp, 0);
+    const auto& r = detail::tables::numeric_records[idx];
+    return numeric_value(r.numerator, r.denominator, r.numeric_type);
 }
 
 
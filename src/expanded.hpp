@@ -0,0 +1,150 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include "properties.hpp"
+
+// Lookups from flat tables expanded at run time, for programs that trade memory for latency.
+// Each table is built on first use, once, whichever thread gets there first.
+// After that, a lookup is a single load.
+// Shipped apart from properties.hpp, which stays free of allocations and locks.
+
+namespace uni::detail {
+
+constexpr std::size_t expanded_properties_count = static_cast<std::size_t>(property::max);
+
+// Bytes used by each expanded table, 0 until it is built
+struct expanded_tables_bytes {
+    std::atomic<std::size_t> category{0};
+    std::atomic<std::size_t> script{0};
+    std::atomic<std::size_t> age{0};
+    std::atomic<std::size_t> properties[expanded_properties_count] = {};
+};
+
+inline expanded_tables_bytes expanded_bytes;
+
+// One byte per code point
+template<typename F>
+std::unique_ptr<std::uint8_t[]> expand_values(F f) {
+    std::unique_ptr<std::uint8_t[]> table(new std::uint8_t[0x110000]);
+    for(char32_t c = 0; c <= 0x10FFFF; c++)
+        table[c] = static_cast<std::uint8_t>(f(c));
+    return table;
+}
+
+// One bit per code point
+inline std::unique_ptr<std::uint64_t[]> expand_property(property p) {
+    std::unique_ptr<std::uint64_t[]> table(new std::uint64_t[0x110000 / 64]());
+    for(const auto r : ranges_of(p)) {
+        for(char32_t c = r.first; c <= r.last; c++)
+            table[c >> 6] |= std::uint64_t(1) << (c & 63);
+    }
+    return table;
+}
+
+inline const std::uint8_t* expanded_categories() {
+    static const auto table = [] {
+        auto t = expand_values([](char32_t c) { return cp_category(c); });
+        expanded_bytes.category = 0x110000;
+        return t;
+    }();
+    return table.get();
+}
+
+inline const std::uint8_t* expanded_scripts() {
+    static const auto table = [] {
+        auto t = expand_values([](char32_t c) { return cp_script(c); });
+        expanded_bytes.script = 0x110000;
+        return t;
+    }();
+    return table.get();
+}
+
+inline const std::uint8_t* expanded_ages() {
+    static const auto table = [] {
+        auto t = expand_values([](char32_t c) { return cp_age(c); });
+        expanded_bytes.age = 0x110000;
+        return t;
+    }();
+    return table.get();
+}
+
+// p < property::max
+inline const std::uint64_t* expanded_property_bits(property p) {
+    static std::once_flag flags[expanded_properties_count];
+    static std::unique_ptr<std::uint64_t[]> tables[expanded_properties_count];
+    const auto i = static_cast<std::size_t>(p);
+    std::call_once(flags[i], [i, p] {
+        tables[i] = expand_property(p);
+        expanded_bytes.properties[i] = 0x110000 / 8;
+    });
+    return tables[i].get();
+}
+
+}    // namespace uni::detail
+
+namespace uni::expanded {
+
+inline category cp_category(char32_t cp) {
+    if(cp > 0x10FFFF)
+        return category::unassigned;
+    return static_cast<category>(detail::expanded_categories()[cp]);
+}
+
+inline script cp_script(char32_t cp) {
+    if(cp > 0x10FFFF)
+        return script::unknown;
+    return static_cast<script>(detail::expanded_scripts()[cp]);
+}
+
+inline version cp_age(char32_t cp) {
+    if(cp > 0x10FFFF)
+        return version::unassigned;
+    return static_cast<version>(detail::expanded_ages()[cp]);
+}
+
+inline bool cp_property_is(property p, char32_t cp) {
+    if(cp > 0x10FFFF || p >= property::max)
+        return false;
+    return (detail::expanded_property_bits(p)[cp >> 6] >> (cp & 63)) & 1;
+}
+
+template<property p>
+bool cp_property_is(char32_t cp) {
+    if constexpr(p >= property::max) {
+        return false;
+    } else {
+        static const std::uint64_t* const bits = detail::expanded_property_bits(p);
+        if(cp > 0x10FFFF)
+            return false;
+        return (bits[cp >> 6] >> (cp & 63)) & 1;
+    }
+}
+
+// Bytes used by the tables expanded so far, 0 for those not built yet
+struct memory_report {
+    std::size_t category = 0;
+    std::size_t script = 0;
+    std::size_t age = 0;
+    std::size_t properties[detail::expanded_properties_count] = {};    // indexed by property
+
+    std::size_t total() const {
+        std::size_t n = category + script + age;
+        for(const auto bytes : properties)
+            n += bytes;
+        return n;
+    }
+};
+
+inline memory_report memory_usage() {
+    memory_report m;
+    m.category = detail::expanded_bytes.category;
+    m.script = detail::expanded_bytes.script;
+    m.age = detail::expanded_bytes.age;
+    for(std::size_t i = 0; i < detail::expanded_properties_count; i++)
+        m.properties[i] = detail::expanded_bytes.properties[i];
+    return m;
+}
+
+}    // namespace uni::expanded
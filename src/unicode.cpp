@@ -1,14 +1,35 @@
 #include "cedilla/properties.hpp"
 
 static_assert(uni::cp_script('C') == uni::script::latin);
+static_assert(uni::cp_script_extensions(U'\u0640').contains(uni::script::syriac));
+static_assert(uni::detail::binary_prop_from_string("scx=Arabic") == uni::detail::binary_prop::scx_arab);
+static_assert(uni::detail::get_binary_prop<uni::detail::binary_prop::scx_arab>(U'\u0640'));
+static_assert(uni::detail::binary_prop_from_string("White Space") == uni::detail::binary_prop::wspace);
+static_assert(uni::detail::binary_prop_from_string("whitespacex") == uni::detail::binary_prop::unknown);
+static_assert(uni::detail::script_from_string("Old-Italic") == uni::script::ital);
+static_assert(uni::detail::block_from_string("basiclatin") == uni::block::basic_latin);
+static_assert(uni::detail::category_from_string("Lu") == uni::category::lu);
+static_assert(uni::detail::category_from_string("") == uni::category::unassigned);
+static_assert(uni::detail::age_from_string("10.0") == uni::version::v10_0);
 static_assert(uni::cp_block(U'🎉') == uni::block::misc_pictographs);
+static_assert((uni::set_of<uni::property::alphabetic>() - uni::set_of<uni::script::latn>()).contains(U'α'));
+static_assert(!(uni::set_of<uni::property::alphabetic>() - uni::set_of<uni::script::latn>()).contains('a'));
+static_assert(uni::block_range(uni::block::basic_latin).last == 0x7F);
+static_assert((*uni::ranges_of(uni::block::basic_latin).begin()).last == 0x7F);
 static_assert(!uni::cp_property_is<uni::property::xid_start>('1'));
 static_assert(uni::cp_property_is<uni::property::xid_continue>('1'));
 static_assert(uni::cp_age(U'🤩') == uni::version::v10_0);
 static_assert(uni::cp_property_is<uni::property::alphabetic>(U'ß'));
+static_assert(uni::cp_property_is_utf8<uni::property::alphabetic>("\xC3\x9F", 2));
 static_assert(uni::cp_category(U'🦝') == uni::category::so);
 static_assert(uni::cp_category_is<uni::category::lowercase_letter>('a'));
 static_assert(uni::cp_category_is<uni::category::letter>('a'));
+static_assert(uni::cp_category_in('1', uni::category::letter | uni::category::number));
 static_assert(uni::cp_property_is<uni::property::emoji>(U'🏳'));
+static_assert((uni::cp_properties('a') & (uni::property::alphabetic | uni::property::lowercase)).count() == 2);
+static_assert(uni::cp_numeric_value(U'½').denominator() == 2 && uni::cp_numeric_value(U'½').type() == uni::numeric_type::nu);
+static_assert(uni::cp_numeric_value('7').type() == uni::numeric_type::de && !uni::cp_numeric_value('a').is_valid());
+static_assert(uni::cp_category_run('b').first == 'a' && uni::cp_category_run('b').last == 'z');
+static_assert(uni::cp_block_run('a').first == 0 && uni::cp_block_run('a').last == 0x7F);
 
 void dummy_symbol() {}
\ No newline at end of file
@@ -0,0 +1,36 @@
+#define CATCH_CONFIG_MAIN
+#include <cedilla/properties.hpp>
+#include <catch2/catch.hpp>
+#include <vector>
+
+// Built with CEDILLA_BATCH_PREFETCH_DISTANCE=64, see CMakeLists.txt
+
+TEST_CASE("Verify that CEDILLA_BATCH_PREFETCH_DISTANCE sets the interleaved vectors") {
+
+    using namespace uni::detail;
+    STATIC_REQUIRE(default_batch_distance == 64);
+    // 16 vectors of SSE4.2, 8 of AVX2 and 4 of AVX-512, instead of 8 of each
+    STATIC_REQUIRE(batch_interleaved_vectors(default_batch_distance, 4) == 16);
+    STATIC_REQUIRE(batch_interleaved_vectors(default_batch_distance, 8) == 8);
+    STATIC_REQUIRE(batch_interleaved_vectors(default_batch_distance, 16) == 4);
+    STATIC_REQUIRE(batch_interleaved_vectors(0, 16) == 1);
+    STATIC_REQUIRE(batch_interleaved_vectors(batch_distance_unset, 16) == 8);
+}
+
+TEST_CASE("Verify that batch lookups match the scalar lookups with a prefetch distance") {
+
+    std::vector<char32_t> text;
+    for(char32_t c = 0; c <= 0x10FFFF + 1; ++c)
+        text.push_back(c);
+    std::vector<uni::category> categories(text.size());
+    for(auto level : {uni::simd_level::scalar, uni::simd_level::sse42, uni::simd_level::avx2, uni::simd_level::avx512}) {
+        if(!uni::set_batch_simd_level(level))
+            continue;
+        INFO("simd level " << static_cast<int>(level));
+        std::fill(categories.begin(), categories.end(), static_cast<uni::category>(0xFF));
+        uni::cp_category(text.data(), text.data() + text.size(), categories.data());
+        for(std::size_t i = 0; i < text.size(); i++)
+            REQUIRE(categories[i] == uni::cp_category(text[i]));
+    }
+    uni::set_batch_simd_level(uni::host_simd_level());
+}
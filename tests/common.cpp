@@ -78,8 +78,20 @@ std::unordered_map<char32_t, cp_test_data> load_test_data() {
                     std::from_chars(nv.data() + idx + 1, nv.data() + nv.size(), d);
                 }
             }
+            // binary properties are the attributes set to Y
+            uni::property_set properties;
+            for(pugi::xml_attribute attr : cp.attributes()) {
+                if(std::string_view(attr.value()) != "Y")
+                    continue;
+                const auto p = uni::detail::binary_prop_from_string(attr.name());
+                if(p == uni::detail::binary_prop::unknown)
+                    continue;
+                const auto desc = uni::detail::tables::binary_prop_descriptors[static_cast<std::size_t>(p)];
+                if(desc.kind == uni::detail::binary_prop_kind::property)
+                    properties = properties | uni::property_set(static_cast<uni::property>(desc.value));
+            }
             for(auto code = first; code <= last; code++)
-                db[code] = {code, name, age, category, block, script, exts, n, d, generated(code)};
+                db[code] = {code, name, age, category, block, script, exts, n, d, generated(code), properties};
         } catch(...) {    // stoi...
         }
     }
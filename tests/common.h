@@ -37,6 +37,7 @@ struct cp_test_data {
     std::vector<uni::script> extensions;
     int64_t n, d;
     bool generated;
+    uni::property_set properties;
 };
 
 std::unordered_map<char32_t, cp_test_data> load_test_data();
\ No newline at end of file
@@ -1,7 +1,11 @@
 #define CATCH_CONFIG_MAIN
 #include "common.h"
 #include <cedilla/properties.hpp>
+#include <cedilla/expanded.hpp>
 #include <catch2/catch.hpp>
+#include <algorithm>
+#include <cstring>
+#include <memory>
 //#include "names.hpp"
 
 const auto codes = load_test_data();
@@ -30,6 +34,21 @@ TEST_CASE("Verify that all code point have the block as in the DB") {
     }
 }
 
+TEST_CASE("Verify that block ranges hold the code points of their block") {
+
+    for(char32_t c = 0; c <= 0x10FFFF + 1; ++c) {
+        const auto b = uni::cp_block(c);
+        const auto range = uni::block_range(b);
+        if(b == uni::block::no_block) {
+            REQUIRE(range.first > range.last);
+            continue;
+        }
+        REQUIRE(range.first <= c);
+        REQUIRE(c <= range.last);
+    }
+    REQUIRE(uni::cp_block(0xFFFFFFFF) == uni::block::no_block);
+}
+
 TEST_CASE("Verify that all code point have the same category as in the DB") {
 
     for(char32_t c = 0; c <= 0x10FFFF + 1; ++c) {
@@ -45,6 +64,22 @@ TEST_CASE("Verify that all code point have the same category as in the DB") {
     }
 }
 
+TEST_CASE("Verify that category masks match the categories in the DB") {
+
+    const auto letter_or_digit = uni::category::letter | uni::category::decimal_number;
+    for(char32_t c = 0; c <= 0x10FFFF + 1; ++c) {
+        auto it = codes.find(c);
+        if(it == codes.end())
+            continue;
+        const auto cat = it->second.category;
+        CHECK(uni::cp_category_in(c, cat));
+        CHECK(uni::cp_category_in(c, uni::category::letter) ==
+              (cat == uni::category::lu || cat == uni::category::ll || cat == uni::category::lt ||
+               cat == uni::category::lm || cat == uni::category::lo));
+        CHECK(uni::cp_category_in(c, letter_or_digit) ==
+              (uni::cp_category_is<uni::category::letter>(c) || cat == uni::category::nd));
+    }
+}
 
 TEST_CASE("Verify that all code point have the script as in the DB") {
 
@@ -76,6 +111,9 @@ TEST_CASE("Verify that all code point have the script extensions as in the DB")
         //std::cout << "script " << std::hex << c << std::dec << " " << int(uni::cp_script(c)) << "\n";
 
         CHECK_THAT(expected, UnorderedEquals(extensions));
+        for(auto s : expected)
+            CHECK(v.contains(s));
+        CHECK(v.scripts().count() == expected.size());
     }
 }
 
@@ -92,9 +130,417 @@ TEST_CASE("Verify that all code point have the numeric value as in the DB") {
         REQUIRE((d != 0 || !nv.is_valid()));
         REQUIRE(d == nv.denominator());
         REQUIRE(n == nv.numerator());
+        REQUIRE(nv.type() == uni::cp_info(c).numeric_type());
+        REQUIRE((nv.type() == uni::numeric_type::none) == !nv.is_valid());
+    }
+}
+
+TEST_CASE("Verify that cp_info matches the DB") {
+
+    for(char32_t c = 0; c <= 0x10FFFF + 1; ++c) {
+        auto it = codes.find(c);
+        if(it == codes.end())
+            continue;
+        const auto info = uni::cp_info(c);
+        CHECK(info.age() == it->second.age);
+        CHECK(info.category() == it->second.category);
+        CHECK(info.block() == it->second.block);
+        CHECK(info.script() == it->second.script);
+        CHECK((info.numeric_type() == uni::numeric_type::none) == (it->second.d == 0));
+    }
+}
+
+TEST_CASE("Verify that all code point have the same binary properties as in the DB") {
+
+    using uni::property;
+    // the emoji properties are read from emoji-data.txt, not from the DB
+    const auto emoji = property::emoji | property::emoji_component | property::emoji_modifier |
+                       property::emoji_modifier_base | property::emoji_presentation | property::extended_pictographic;
+    for(char32_t c = 0; c <= 0x10FFFF; ++c) {
+        auto it = codes.find(c);
+        if(it == codes.end())
+            continue;
+        INFO("U+" << n2hexstr(c, 4));
+        for(std::size_t i = 0; i < static_cast<std::size_t>(property::max); i++) {
+            const auto p = static_cast<property>(i);
+            if(emoji.contains(p))
+                continue;
+            INFO("property " << i);
+            REQUIRE(uni::cp_property_is(p, c) == it->second.properties.contains(p));
+        }
+        // properties that were not answered from the UCD before
+        REQUIRE(uni::cp_property_is<property::case_ignorable>(c) == it->second.properties.contains(property::ci));
+        REQUIRE(uni::cp_property_is<property::lowercase>(c) == it->second.properties.contains(property::lower));
+    }
+}
+
+TEST_CASE("Verify that batch lookups match the scalar lookups") {
+
+    std::vector<char32_t> text;
+    for(char32_t c = 0; c <= 0x10FFFF + 1; ++c)
+        text.push_back(c);
+    text.push_back(0xFFFFFFFF);
+    // start past the first element so that the last elements go through the scalar tail
+    const char32_t* first = text.data() + 1;
+    const char32_t* last = text.data() + text.size();
+    const auto n = std::size_t(last - first);
+
+    std::vector<uni::category> categories(n);
+    std::vector<uni::script> scripts(n);
+    std::unique_ptr<bool[]> alpha(new bool[n]);
+    std::unique_ptr<bool[]> xids(new bool[n]);
+    std::unique_ptr<bool[]> math(new bool[n]);
+    // bytes of a bool output, 0xAA until a lookup stores 0 or 1
+    const auto bytes = [](const std::unique_ptr<bool[]>& b, std::size_t i) {
+        return reinterpret_cast<const unsigned char*>(b.get())[i];
+    };
+
+    // every kernel the host can run
+    for(auto level : {uni::simd_level::scalar, uni::simd_level::sse42, uni::simd_level::avx2, uni::simd_level::avx512}) {
+        if(!uni::set_batch_simd_level(level))
+            continue;
+        INFO("simd level " << static_cast<int>(level));
+        REQUIRE(uni::batch_simd_level() == level);
+        // values no lookup returns, so that entries left over by the previous level are caught
+        std::fill(categories.begin(), categories.end(), static_cast<uni::category>(0xFF));
+        std::fill(scripts.begin(), scripts.end(), static_cast<uni::script>(0xFF));
+        std::memset(alpha.get(), 0xAA, n);
+        std::memset(xids.get(), 0xAA, n);
+        std::memset(math.get(), 0xAA, n);
+        uni::cp_category(first, last, categories.data());
+        uni::cp_script(first, last, scripts.data());
+        uni::cp_property_is<uni::property::alphabetic>(first, last, alpha.get());
+        uni::cp_property_is<uni::property::xid_start>(first, last, xids.get());
+        uni::cp_property_is(uni::property::math, first, last, math.get());
+
+        for(std::size_t i = 0; i < n; i++) {
+            const char32_t c = first[i];
+            REQUIRE(categories[i] != static_cast<uni::category>(0xFF));
+            REQUIRE(scripts[i] != static_cast<uni::script>(0xFF));
+            REQUIRE(bytes(alpha, i) <= 1);
+            REQUIRE(bytes(xids, i) <= 1);
+            REQUIRE(bytes(math, i) <= 1);
+            REQUIRE(categories[i] == uni::cp_category(c));
+            REQUIRE(scripts[i] == uni::cp_script(c));
+            REQUIRE(alpha[i] == uni::cp_property_is<uni::property::alphabetic>(c));
+            REQUIRE(xids[i] == uni::cp_property_is<uni::property::xid_start>(c));
+            REQUIRE(math[i] == uni::cp_property_is<uni::property::math>(c));
+        }
+    }
+    CHECK(!uni::set_batch_simd_level(static_cast<uni::simd_level>(static_cast<int>(uni::host_simd_level()) + 1)));
+    uni::set_batch_simd_level(uni::host_simd_level());
+}
+
+TEST_CASE("Verify that range arrays end at their end marker") {
+
+    using uni::detail::range_array;
+    // A last range reaching U+10FFFF needs an entry past it, as gen.py emits
+    constexpr range_array<3> with_marker{{(0x20u << 8) | 1, (0x10FFFEu << 8) | 1, (0x110000u << 8)}};
+    constexpr range_array<2> without_marker{{(0x20u << 8) | 1, (0x10FFFEu << 8) | 1}};
+    REQUIRE(with_marker.lookup(0x10FFFE));
+    REQUIRE(with_marker.lookup(0x10FFFF));
+    REQUIRE(!without_marker.lookup(0x10FFFE));
+    REQUIRE(!without_marker.lookup(0x10FFFF));
+    REQUIRE(without_marker.lookup(0x20));
+
+    constexpr uni::detail::flat_array<0> empty{};
+    REQUIRE(!empty.lookup(0));
+}
+
+TEST_CASE("Verify that the expanded tables match the compressed ones") {
+
+    using uni::property;
+    const auto alphabetic = static_cast<std::size_t>(property::alphabetic);
+    const auto emoji = static_cast<std::size_t>(property::emoji);
+    REQUIRE(uni::expanded::memory_usage().properties[emoji] == 0);
+    for(char32_t c = 0; c <= 0x10FFFF + 1; ++c) {
+        REQUIRE(uni::expanded::cp_category(c) == uni::cp_category(c));
+        REQUIRE(uni::expanded::cp_script(c) == uni::cp_script(c));
+        REQUIRE(uni::expanded::cp_age(c) == uni::cp_age(c));
+        REQUIRE(uni::expanded::cp_property_is<property::alphabetic>(c) ==
+                uni::cp_property_is<property::alphabetic>(c));
+        REQUIRE(uni::expanded::cp_property_is(property::emoji, c) == uni::cp_property_is<property::emoji>(c));
+    }
+    REQUIRE(!uni::expanded::cp_property_is(property::max, 0x41));
+    REQUIRE(!uni::expanded::cp_property_is<property::max>(0x41));
+    // Other test cases may have expanded tables too, only check the ones used here
+    const auto usage = uni::expanded::memory_usage();
+    REQUIRE(usage.category == 0x110000);
+    REQUIRE(usage.script == 0x110000);
+    REQUIRE(usage.age == 0x110000);
+    REQUIRE(usage.properties[alphabetic] == 0x110000 / 8);
+    REQUIRE(usage.properties[emoji] == 0x110000 / 8);
+    REQUIRE(usage.properties[static_cast<std::size_t>(property::wspace)] == 0);
+}
+
+TEST_CASE("Verify that cursor lookups match the scalar lookups") {
+
+    // forward, backward and jumping around, which misses the remembered ranges
+    std::vector<char32_t> text;
+    for(char32_t c = 0; c <= 0x10FFFF + 1; ++c)
+        text.push_back(c);
+    for(char32_t c = 0x10FFFF + 1; c-- > 0;)
+        text.push_back(c);
+    std::uint32_t x = 1;
+    for(int i = 0; i < 0x100000; i++) {
+        x = x * 1103515245 + 12345;
+        text.push_back((x >> 8) % 0x110001);
+    }
+    uni::lookup_cursor cursor;
+    for(char32_t c : text) {
+        REQUIRE(cursor.cp_script(c) == uni::cp_script(c));
+        REQUIRE(cursor.cp_age(c) == uni::cp_age(c));
+        REQUIRE(cursor.cp_block(c) == uni::cp_block(c));
     }
 }
 
+TEST_CASE("Verify that cursor lookups step back into the first range") {
+
+    // from a remembered range back into the first one of the table
+    uni::lookup_cursor cursor;
+    for(char32_t c : {char32_t(0x4E00), char32_t(0x41), char32_t(0), char32_t(0x10FFFF), char32_t(0x20)}) {
+        REQUIRE(cursor.cp_script(c) == uni::cp_script(c));
+        REQUIRE(cursor.cp_age(c) == uni::cp_age(c));
+    }
+
+    // a table whose first range does not start at 0 holds nothing before it, or from its end marker on
+    constexpr uni::detail::compact_range<std::uint8_t, 3> table{{(0x41 << 8) | 1, (0x61 << 8) | 2, (0x7B << 8)}};
+    uni::detail::range_hint hint;
+    for(char32_t c : {char32_t(0x62), char32_t(0x41), char32_t(0x40), char32_t(0x61), char32_t(0), char32_t(0x7B),
+                      char32_t(0x7A), char32_t(0x10FFFF), char32_t(0x41)}) {
+        REQUIRE(table.value(c, 0xFF, hint) == table.value(c, 0xFF));
+    }
+}
+
+TEST_CASE("Verify that the Latin-1 records match the tables") {
+
+    using namespace uni::detail::tables;
+    for(char32_t c = 0; c <= 0xFF; ++c) {
+        const auto& r = latin1_data[c];
+        REQUIRE(r.properties == property_rows[property_data.lookup(c, 0)]);
+        REQUIRE(r.category == category_data.lookup(c, 0));
+        REQUIRE(r.script == script_data.value(c, 0));
+        REQUIRE(r.block == block_data.lookup(c >> 4, 0));
+        REQUIRE(r.age == age_data.value(c, 0));
+        REQUIRE(r.info == cp_info_data.lookup(c, 0));
+    }
+}
+
+static std::size_t encode_utf8(char32_t c, unsigned char* s) {
+    if(c < 0x80) {
+        s[0] = static_cast<unsigned char>(c);
+        return 1;
+    }
+    if(c < 0x800) {
+        s[0] = static_cast<unsigned char>(0xC0 | (c >> 6));
+        s[1] = static_cast<unsigned char>(0x80 | (c & 0x3F));
+        return 2;
+    }
+    if(c < 0x10000) {
+        s[0] = static_cast<unsigned char>(0xE0 | (c >> 12));
+        s[1] = static_cast<unsigned char>(0x80 | ((c >> 6) & 0x3F));
+        s[2] = static_cast<unsigned char>(0x80 | (c & 0x3F));
+        return 3;
+    }
+    s[0] = static_cast<unsigned char>(0xF0 | (c >> 18));
+    s[1] = static_cast<unsigned char>(0x80 | ((c >> 12) & 0x3F));
+    s[2] = static_cast<unsigned char>(0x80 | ((c >> 6) & 0x3F));
+    s[3] = static_cast<unsigned char>(0x80 | (c & 0x3F));
+    return 4;
+}
+
+TEST_CASE("Verify that UTF-8 lookups match the code point lookups") {
+
+    using namespace uni::detail::tables;
+    unsigned char s[4] = {};
+    for(char32_t c = 0; c <= 0x10FFFF; ++c) {
+        const std::size_t n = encode_utf8(c, s);
+        REQUIRE(uni::cp_property_is_utf8<uni::property::alphabetic>(s, n) ==
+                uni::cp_property_is<uni::property::alphabetic>(c));
+        REQUIRE(uni::cp_property_is_utf8<uni::property::xid_start>(s, n) ==
+                uni::cp_property_is<uni::property::xid_start>(c));
+        REQUIRE(uni::cp_property_is_utf8<uni::property::wspace>(s, n) == uni::cp_property_is<uni::property::wspace>(c));
+        REQUIRE(uni::cp_property_is_utf8<uni::property::dash>(s, n) == uni::cp_property_is<uni::property::dash>(c));
+        REQUIRE(prop_assigned.lookup_utf8(s, n) == prop_assigned.lookup(c));
+        REQUIRE(age_data.value_utf8(s, n, 0) == age_data.value(c, 0));
+        // sequences cut short are not code points
+        REQUIRE(!prop_assigned.lookup_utf8(s, n - 1));
+        REQUIRE(!uni::cp_property_is_utf8<uni::property::gr_base>(s, n - 1));
+    }
+    // continuation bytes and bytes that cannot start a sequence
+    for(unsigned b : {0x80u, 0xBFu, 0xC0u, 0xC1u, 0xF5u, 0xFFu}) {
+        s[0] = static_cast<unsigned char>(b);
+        s[1] = s[2] = s[3] = 0x80;
+        REQUIRE(!prop_assigned.lookup_utf8(s, 4));
+        REQUIRE(!uni::cp_property_is_utf8<uni::property::gr_base>(s, 4));
+    }
+    REQUIRE(uni::cp_property_is_utf8<uni::property::alphabetic>("\xC3\x9F", 2));
+}
+
+// Checks that the ranges are ordered and maximal, that their code points match
+// and returns how many code points they hold
+template<typename Ranges, typename Match>
+static std::size_t check_ranges(Ranges ranges, Match match) {
+    std::size_t count = 0;
+    char32_t next = 0;
+    for(const auto r : ranges) {
+        REQUIRE(r.first <= r.last);
+        REQUIRE(r.last <= 0x10FFFF);
+        REQUIRE((count == 0 || r.first > next));
+        REQUIRE(match(r.first));
+        REQUIRE(match(r.last));
+        if(r.first > 0)
+            REQUIRE(!match(r.first - 1));
+        if(r.last < 0x10FFFF)
+            REQUIRE(!match(r.last + 1));
+        count += r.last - r.first + 1;
+        next = r.last + 1;
+    }
+    return count;
+}
+
+TEST_CASE("Verify that ranges_of yields the code points of each property, category, script and block") {
+
+    std::vector<std::size_t> categories(std::size_t(uni::category::max));
+    std::vector<std::size_t> scripts(std::size_t(uni::script::max));
+    std::vector<std::size_t> blocks(std::size_t(uni::block::__max));
+    std::vector<std::size_t> properties(std::size_t(uni::property::max));
+    for(char32_t c = 0; c <= 0x10FFFF; ++c) {
+        categories[std::size_t(uni::cp_category(c))]++;
+        scripts[std::size_t(uni::cp_info(c).script())]++;
+        blocks[std::size_t(uni::cp_block(c))]++;
+        for(std::size_t p = 0; p < properties.size(); p++)
+            properties[p] += uni::cp_property_is(uni::property(p), c);
+    }
+
+    for(std::size_t i = 0; i < categories.size(); i++) {
+        const auto cat = uni::category(i);
+        std::size_t expected = 0;
+        for(std::size_t j = 0; j < categories.size(); j++)
+            expected += uni::category_mask(cat).contains(uni::category(j)) ? categories[j] : 0;
+        CHECK(check_ranges(uni::ranges_of(cat), [cat](char32_t c) { return uni::cp_category_in(c, cat); }) == expected);
+    }
+    for(std::size_t i = 0; i < scripts.size(); i++) {
+        const auto sc = uni::script(i);
+        CHECK(check_ranges(uni::ranges_of(sc), [sc](char32_t c) { return uni::cp_info(c).script() == sc; }) ==
+              scripts[i]);
+    }
+    for(std::size_t i = 1; i < blocks.size(); i++) {
+        const auto b = uni::block(i);
+        CHECK(check_ranges(uni::ranges_of(b), [b](char32_t c) { return uni::cp_block(c) == b; }) == blocks[i]);
+    }
+    for(std::size_t i = 0; i < properties.size(); i++) {
+        const auto p = uni::property(i);
+        CHECK(check_ranges(uni::ranges_of(p), [p](char32_t c) { return uni::cp_property_is(p, c); }) ==
+              properties[i]);
+    }
+    REQUIRE(check_ranges(uni::ranges_of<uni::property::alphabetic>(),
+                         [](char32_t c) { return uni::cp_property_is<uni::property::alphabetic>(c); }) ==
+            properties[std::size_t(uni::property::alphabetic)]);
+}
+
+// Walks the runs of run(c) from U+0000: each must start where the previous one ended,
+// hold code points of its value only and end before a different one.
+// Each run is also queried from its last code point.
+template<typename Run, typename Value>
+static void check_runs(Run run, Value value) {
+    char32_t c = 0;
+    while(c <= 0x10FFFF) {
+        const auto r = run(c);
+        REQUIRE(r.first == c);
+        REQUIRE(r.first <= r.last);
+        REQUIRE(r.last <= 0x10FFFF);
+        bool same = true;
+        for(char32_t i = r.first; i <= r.last; i++)
+            same = same && value(i) == r.value;
+        REQUIRE(same);
+        if(r.last < 0x10FFFF)
+            REQUIRE(value(r.last + 1) != r.value);
+        const auto from_last = run(r.last);
+        REQUIRE(from_last.first == r.first);
+        REQUIRE(from_last.last == r.last);
+        c = r.last + 1;
+    }
+    const auto past = run(0x110000);
+    REQUIRE(past.first == 0x110000);
+    REQUIRE(past.last == 0x110000);
+    REQUIRE(past.value == value(0x110000));
+}
+
+TEST_CASE("Verify that runs hold the code points sharing a value") {
+    check_runs([](char32_t c) { return uni::cp_category_run(c); }, [](char32_t c) { return uni::cp_category(c); });
+    check_runs([](char32_t c) { return uni::cp_script_run(c); }, [](char32_t c) { return uni::cp_script(c); });
+    check_runs([](char32_t c) { return uni::cp_age_run(c); }, [](char32_t c) { return uni::cp_age(c); });
+    check_runs([](char32_t c) { return uni::cp_block_run(c); }, [](char32_t c) { return uni::cp_block(c); });
+    for(std::size_t i = 0; i < std::size_t(uni::property::max); i++) {
+        const auto p = uni::property(i);
+        check_runs([p](char32_t c) { return uni::cp_property_run(p, c); },
+                   [p](char32_t c) { return uni::cp_property_is(p, c); });
+    }
+}
+
+TEST_CASE("Verify that code point sets match the properties they are made of") {
+
+    using namespace uni;
+    constexpr auto alpha_not_latin = set_of<property::alphabetic>() - set_of<script::latn>();
+    constexpr auto word = set_of<category::lu>() | set_of<category::lt>() | set_of<category::nd>() | set_of<category::pc>();
+    constexpr auto latin_non_letters = ~set_of<category::letter>() & set_of<block::basic_latin>();
+    constexpr auto empty = set_of<script::grek>() & set_of<script::cyrl>();
+
+    for(char32_t c = 0; c <= 0x10FFFF + 1; ++c) {
+        REQUIRE(alpha_not_latin.contains(c) ==
+                (cp_property_is<property::alphabetic>(c) && cp_script(c) != script::latn));
+        REQUIRE(word.contains(c) == cp_category_in(c, category::lu | category::lt | category::nd | category::pc));
+        REQUIRE(latin_non_letters.contains(c) ==
+                (!cp_category_in(c, category::letter) && cp_block(c) == block::basic_latin));
+        REQUIRE(!empty.contains(c));
+    }
+    REQUIRE(!(~empty).contains(0xFFFFFFFF));
+}
+
+template<uni::detail::binary_prop p>
+static void check_runtime_binary_prop(const char32_t* first, const char32_t* last) {
+    const auto n = std::size_t(last - first);
+    std::unique_ptr<bool[]> out(new bool[n]);
+    uni::detail::cp_has_binary_prop(p, first, last, out.get());
+    for(std::size_t i = 0; i < n; i++) {
+        REQUIRE(out[i] == uni::detail::get_binary_prop<p>(first[i]));
+        REQUIRE(uni::detail::cp_has_binary_prop(p, first[i]) == out[i]);
+    }
+}
+
+TEST_CASE("Verify that runtime property queries match the compile time ones") {
+
+    std::vector<char32_t> text;
+    for(char32_t c = 0; c <= 0x10FFFF + 1; ++c)
+        text.push_back(c);
+    text.push_back(0xFFFFFFFF);
+    const char32_t* first = text.data() + 1;
+    const char32_t* last = text.data() + text.size();
+    const auto n = std::size_t(last - first);
+
+    std::unique_ptr<bool[]> alpha(new bool[n]);
+    std::unique_ptr<bool[]> emoji(new bool[n]);
+    uni::cp_property_is(uni::property::alphabetic, first, last, alpha.get());
+    uni::cp_property_is(uni::property::emoji, first, last, emoji.get());
+    for(std::size_t i = 0; i < n; i++) {
+        const char32_t c = first[i];
+        REQUIRE(alpha[i] == uni::cp_property_is<uni::property::alphabetic>(c));
+        REQUIRE(emoji[i] == uni::cp_property_is<uni::property::emoji>(c));
+        REQUIRE(uni::cp_property_is(uni::property::lowercase, c) == uni::cp_property_is<uni::property::lowercase>(c));
+    }
+
+    using uni::detail::binary_prop;
+    check_runtime_binary_prop<binary_prop::wspace>(first, last);
+    check_runtime_binary_prop<binary_prop::lu>(first, last);
+    check_runtime_binary_prop<binary_prop::l>(first, last);
+    check_runtime_binary_prop<binary_prop::grek>(first, last);
+    check_runtime_binary_prop<binary_prop::scx_arab>(first, last);
+    check_runtime_binary_prop<binary_prop::ascii>(first, last);
+    check_runtime_binary_prop<binary_prop::assigned>(first, last);
+    check_runtime_binary_prop<binary_prop::any>(first, last);
+    REQUIRE(!uni::detail::cp_has_binary_prop(binary_prop::unknown, 'a'));
+}
 
 /*TEST_CASE("Verify that all code point have the name as in the db") {
 
@@ -13,6 +13,57 @@ LAST_VERSION = "14.0"
 PROPS_VALUE_FILE = os.path.join(DIR_WITH_UCD, "PropertyValueAliases.txt")
 BINARY_PROPS_FILE = os.path.join(DIR_WITH_UCD, "binary_props.txt")
 
+## Layout of the compact_range and range_array tables: sorted, eytzinger or stree
+RANGE_LAYOUT = "sorted"
+for arg in sys.argv[4:]:
+    if arg.startswith("--range-layout="):
+        RANGE_LAYOUT = arg[len("--range-layout="):]
+if RANGE_LAYOUT not in ["sorted", "eytzinger", "stree"]:
+    sys.exit("unknown range layout: " + RANGE_LAYOUT)
+
+## Default layout of the bool_trie tables: trimmed or padded.
+## trimmed drops the leading and trailing zero entries of the stage arrays,
+## padded keeps them so that lookups need no range check and no branch.
+BOOL_TRIE_LAYOUT = "trimmed"
+for arg in sys.argv[4:]:
+    if arg.startswith("--bool-trie-layout="):
+        BOOL_TRIE_LAYOUT = arg[len("--bool-trie-layout="):]
+if BOOL_TRIE_LAYOUT not in ["trimmed", "padded"]:
+    sys.exit("unknown bool trie layout: " + BOOL_TRIE_LAYOUT)
+
+## How the representation of each table is picked, the API is the same whichever is used.
+## minimal keeps the smallest representation of each table,
+## balanced uses ranges or arrays for tables under 200 bytes and tries above,
+## latency never binary searches: hot lookups go through tries and small arrays are scanned.
+TABLE_POLICY = "balanced"
+for arg in sys.argv[4:]:
+    if arg.startswith("--table-policy="):
+        TABLE_POLICY = arg[len("--table-policy="):]
+if TABLE_POLICY not in ["minimal", "balanced", "latency"]:
+    sys.exit("unknown table policy: " + TABLE_POLICY)
+
+## Tables the lookups read: the policy picks their representation and the summary lists them.
+## Any other table keeps its smallest representation.
+LOOKUP_TABLES = {"category_data", "property_data", "cp_info_data", "script_data", "age_data", "block_data",
+                 "numeric_data", "prop_assigned"}
+
+## flat_array scans tables of less than 20 elements and binary searches the others
+FLAT_ARRAY_SCAN_LIMIT = 20
+
+## Tables read by the lookups of typical text. They are grouped in a section of their own
+## (CEDILLA_HOT_TABLE) so that they share pages, apart from the tables of the rarely queried
+## properties, the names and the regex support. They start on a cache line, as do the other
+## tables larger than one, while smaller cold tables keep their natural alignment.
+HOT_TABLES = {"latin1_data", "category_data", "cp_info_data", "cp_info_records", "property_data", "property_rows",
+              "block_data", "numeric_data", "numeric_records", "numeric_pages", "prop_assigned", "script_set_bits"}
+if TABLE_POLICY != "latency":
+    HOT_TABLES |= {"script_data", "age_data"}
+
+def table_storage(name, size):
+    if name in HOT_TABLES:
+        return "CEDILLA_HOT_TABLE"
+    return "alignas(64)" if size > 64 else ""
+
 EMOJI_PROPERTIES  = ["emoji", "emoji_presentation", "emoji_modifier", "emoji_modifier_base", "emoji_component", "extended_pictographic"]
 
 def cp_code(cp):
@@ -23,6 +74,80 @@ def cp_code(cp):
 def to_hex(cp, n = 6):
     return "{0:#0{fill}X}".format(int(cp), fill=n).replace('X', 'x')
 
+def eytzinger(entries):
+    ## lays out sorted entries as an implicit binary search tree rooted at 1,
+    ## the children of k being 2k and 2k + 1. The tree is made complete with copies of
+    ## the last entry, which is also stored first.
+    size = 1
+    while size < len(entries) + 1:
+        size *= 2
+    entries = entries + [entries[-1]] * (size - 1 - len(entries))
+    tree = [entries[-1]] * size
+    it = iter(entries)
+    def fill(k):
+        if k < size:
+            fill(2 * k)
+            tree[k] = next(it)
+            fill(2 * k + 1)
+    fill(1)
+    return tree
+
+def stree(entries):
+    ## lays out sorted entries as a complete B-tree of nodes of 16 entries, the children of
+    ## node k being 17k + 1 .. 17k + 17. Padded with copies of the last entry, which is also stored last.
+    b = 16
+    size = b
+    while size < len(entries):
+        size = size * (b + 1) + b
+    entries = entries + [entries[-1]] * (size - len(entries))
+    tree = [0] * size
+    it = iter(entries)
+    def fill(k):
+        if k * b < size:
+            for i in range(b + 1):
+                fill(k * (b + 1) + i + 1)
+                if i < b:
+                    tree[k * b + i] = next(it)
+    fill(0)
+    return tree + [entries[-1]]
+
+def layout_ranges(entries):
+    if RANGE_LAYOUT == "eytzinger":
+        return eytzinger(entries)
+    if RANGE_LAYOUT == "stree":
+        return stree(entries)
+    return entries
+
+## (name, type, bytes, cost of a lookup) of each table, written at the end of the header
+TABLES_SUMMARY = []
+
+def search_cost(n):
+    return "{} probes".format(max(1, (n - 1).bit_length()))
+
+def write_tables_summary(f):
+    summary = [t for t in TABLES_SUMMARY if t[0] in LOOKUP_TABLES]
+    f.write("\n// Tables generated with --table-policy={}\n".format(TABLE_POLICY))
+    width = max(len(t[0]) for t in summary)
+    for name, kind, size, cost in summary:
+        f.write("// {} {:<12} {:>7} bytes  {}\n".format(name.ljust(width), kind, size, cost))
+    total = sum(t[2] for t in summary)
+    f.write("// {} {:<12} {:>7} bytes\n".format("total".ljust(width), "", total))
+    if TABLE_POLICY == "latency":
+        f.write("// cp_script and cp_age read cp_info_data, script_data and age_data serve runs and cursors\n")
+    print("{} policy: {} tables, {} bytes".format(TABLE_POLICY, len(summary), total))
+    for kind in ["flat_array", "range_array", "compact_range", "bool_trie", "value_trie"]:
+        tables = [t for t in summary if t[1] == kind]
+        if tables:
+            print("  {:<13} {:>3} tables, {:>7} bytes".format(kind, len(tables), sum(t[2] for t in tables)))
+
+def emit_compact_range(f, name, entries):
+    TABLES_SUMMARY.append((name, "compact_range", len(entries) * 4, search_cost(len(entries))))
+    entries = layout_ranges(entries)
+    f.write("{} static constexpr compact_range<std::uint8_t, {}, range_layout::{}> {} = {{".format(
+        table_storage(name, len(entries) * 4), len(entries), RANGE_LAYOUT, name))
+    f.write(",".join(to_hex(e, 10) for e in entries))
+    f.write("};\n")
+
 def age_name(age):
     if age == 'unassigned':
         return age
@@ -51,6 +176,7 @@ class ucd_cp(object):
 
         self.block = char.get("blk").lower().replace("-", "_").replace(" ", "_")
         self.nv = None if char.get("nv") == 'NaN' else char.get("nv").split("/")
+        self.nt = char.get("nt").lower()
         for p in [ "AHex",
             "Alpha",
             "Bidi_C",
@@ -119,15 +245,65 @@ class ucd_cp(object):
             self.props[p] = False
 
 
+def loose_name(name):
+    ## UAX44-LM3 loose matching, ignores case, whitespace, underscores and hyphens
+    return ''.join(c.lower() for c in name if c not in ' \t\n\r\f\v_-')
+
+def name_hash(name):
+    ## 32 bits FNV-1a of the loose form of the name, see detail::propnamehash
+    h = 2166136261
+    for c in loose_name(name).encode():
+        h = ((h ^ c) * 16777619) & 0xFFFFFFFF
+    return h
+
+def name_mix(h, seed):
+    ## see detail::propnamemix
+    h = (h ^ (seed * 0x9E3779B9)) & 0xFFFFFFFF
+    h ^= h >> 16
+    h = (h * 0x85EBCA6B) & 0xFFFFFFFF
+    h ^= h >> 13
+    h = (h * 0xC2B2AE35) & 0xFFFFFFFF
+    return h ^ (h >> 16)
+
+def perfect_hash(keys):
+    ## Minimal perfect hash (hash and displace): a key goes in bucket mix(h, 0) % buckets
+    ## and in slot mix(h, seeds[bucket]) % len(keys). Seeds are found for the biggest buckets first.
+    hashes = [name_hash(k) for k in keys]
+    assert len(set(hashes)) == len(hashes)
+    n = len(keys)
+    nbuckets = (n + 2) // 3
+    buckets = [[] for _ in range(nbuckets)]
+    for i, h in enumerate(hashes):
+        buckets[name_mix(h, 0) % nbuckets].append(i)
+    seeds = [0] * nbuckets
+    slots = [None] * n
+    for b in sorted(range(nbuckets), key = lambda b: -len(buckets[b])):
+        if not buckets[b]:
+            continue
+        seed = 1
+        while True:
+            taken = [name_mix(hashes[i], seed) % n for i in buckets[b]]
+            if len(set(taken)) == len(taken) and all(slots[t] == None for t in taken):
+                break
+            seed += 1
+            assert seed < 0x10000
+        seeds[b] = seed
+        for i, t in zip(buckets[b], taken):
+            slots[t] = i
+    return seeds, slots
+
 def write_string_array(f, array_name, strings_with_idx):
+    ## names are looked up through a minimal perfect hash of their loose form
     dct = dict(strings_with_idx)
-    f.write("static constexpr string_with_idx {}[]  = {{".format(array_name))
-    keys = list(filter(None,  dct.keys()))
-    keys.sort()
-
-    for idx, key in enumerate(keys):
-        f.write('string_with_idx{{ "{}", {} }} {}'.format(key, dct[key], "," if idx < len(keys) -1 else ""))
-    f.write("};\n")
+    loose = {}
+    for key in filter(None, dct.keys()):
+        other = loose.setdefault(loose_name(key), key)
+        assert dct[other] == dct[key], "{} and {} are ambiguous".format(other, key)
+    keys = sorted(loose.values())
+    seeds, slots = perfect_hash(keys)
+    f.write("static constexpr string_table<{}, {}> {} = {{{{".format(len(keys), len(seeds), array_name))
+    f.write(",".join('string_with_idx{{ "{}", {} }}'.format(keys[i], dct[keys[i]]) for i in slots))
+    f.write("}}, {{ {} }}}};\n".format(",".join(map(str, seeds))))
 
 def get_scripts_names():
     scripts = []
@@ -159,6 +335,16 @@ def get_cats_names():
             cats.append((m.group(1).lower(), m.group(2).lower()))
     return cats
 
+def get_numeric_types_names():
+    types = []
+    regex = re.compile("^nt\\s*;\\s*(\\w+)\\s*;\\s*(\\w+).*$")
+    lines = [line.rstrip('\n') for line in open(PROPS_VALUE_FILE, 'r')]
+    for line in lines:
+        m = regex.match(line)
+        if m:
+            types.append((m.group(1).lower(), m.group(2).lower()))
+    return types
+
 class ucd_block:
     def __init__(self, block):
         self.first   = cp_code(block.get('first-cp'))
@@ -230,47 +416,54 @@ def write_script_data(characters, scripts_names, file):
     write_string_array(f, "scripts_names", [(script[0], idx) for idx, script in enumerate(scripts_names)]
                                            + [(script[1], idx) for idx, script in enumerate(scripts_names)])
 
-    f.write("template <auto N> struct script_data;")
-
-    character_map = dict((c.cp, c.scx) for c in characters)
-
-    def write_block(idx, characters):
-        f.write("template <> struct script_data<{}> {{".format(idx))
-        f.write("static constexpr const compact_range scripts_data= {")
-        prev = ''
-        for cp in range(0x10FFFF):
-            script = 'zzzz'
-            if (cp in characters and len(characters[cp]) > idx):
-                script = characters[cp][idx]
-            if script != prev:
-                f.write("{},".format(to_hex((cp << 8) | indexes[script], 10)))
-            prev = script
-        f.write("0xFFFFFFFF")
-        f.write("};};")
-
-    l = max([len(cp.scx) for cp in characters])
+    known = dict((c.cp, c.sc) for c in characters)
+    entries = []
+    prev = ''
+    for cp in range(0x10FFFF):
+        script = known.get(cp, 'zzzz')
+        if script != prev:
+            entries.append((cp << 8) | indexes[script])
+        prev = script
+    entries.append(0xFFFFFFFF)
+    emit_compact_range(f, "script_data", entries)
+
+    ## Script_Extensions sets, indexed by the script_extensions field of the cp_info records
+    assert len(scripts_names) <= 256
+    sets, _ = script_extensions_sets(characters, scripts_names)
+    f.write(table_storage("script_set_bits", len(sets) * 32) + " static constexpr std::uint64_t script_set_bits[][4] = {")
+    for scripts in sets:
+        words = [0] * 4
+        for idx in scripts:
+            words[idx // 64] |= 1 << (idx % 64)
+        f.write("{{ {} }},".format(",".join(to_hex(w, 18) for w in words)))
+    f.write("};")
+    print("script_set_bits : {} sets - size: {}".format(len(sets), len(sets) * 32))
 
-    for i in range(l):
-        write_block(i, character_map)
 
+def write_script_and_age_lookups(f):
+    ## script_data and age_data are binary searched, with the latency policy
+    ## cp_script and cp_age read the cp_info records instead
+    if TABLE_POLICY == "latency":
+        f.write("""
+        constexpr script get_script(char32_t cp) {
+            return static_cast<uni::script>(cp_info_records[cp_info_data.lookup(cp, 0)].script);
+        }
+        constexpr version get_age(char32_t cp) {
+            return static_cast<uni::version>(cp_info_records[cp_info_data.lookup(cp, 0)].age);
+        }
+        """)
+        return
     f.write("""
-    template<auto N>
-    constexpr script cp_script(char32_t cp) {
+    constexpr script get_script(char32_t cp) {
         if(cp > 0x10FFFF)
             return script::unknown;
-
-        uni::script sc = static_cast<uni::script>(script_data<N>::scripts_data.value(cp, uint8_t(script::unknown)));
-        return sc;
+        return static_cast<uni::script>(script_data.value(cp, uint8_t(script::unknown)));
+    }
+    constexpr version get_age(char32_t cp) {
+        return static_cast<uni::version>(age_data.value(cp, uint8_t(version::unassigned)));
     }
     """)
 
-    f.write("constexpr script get_cp_script(char32_t cp, int idx) {")
-    f.write("switch(idx) {")
-    for i in range(l):
-        f.write("case {0}: return cp_script<{0}>(cp);".format(i))
-    f.write("} return script::zzzz;}")
-
-
 def write_enum_blocks(blocks_names, blocks, file):
     aliases = dict([(block[0], block[1:]) for block in blocks_names])
     aliases.update(dict([(block[1], block) for block in blocks_names]))
@@ -294,21 +487,21 @@ def write_enum_blocks(blocks_names, blocks, file):
 
 def write_blocks_data(indexed_names, blocks, file):
     write_string_array(file, "blocks_names", indexed_names)
-    ## Blocks are stored as a compact range where
-    ##  * if the low bit is 0, the range is not assigned to a block
-    ##  * otherwise the low bit is an offset to substract from the index of the range entry to get the
-    ##  value of the block as specified by the enum
-    f.write("static constexpr const compact_range block_data = {")
-    prev = -1
-    offset = 0;
-    for i, b in enumerate(blocks):
-        if (b.first != prev + 1):
-            f.write("{},".format(to_hex(((prev + 1) << 8), 10)))
-            offset = offset + 1
-        f.write("{},".format(to_hex(((b.first) << 8) | (offset + 1), 10)))
-        prev = b.last
-    f.write("0xFFFFFFFF")
-    f.write("};\n")
+    ## Blocks start and end on 16 code points boundaries, a value trie indexed by cp >> 4
+    ## maps each of these pages to its block
+    pages = [0] * (0x110000 >> 4)
+    for idx, b in enumerate(blocks):
+        assert b.first % 16 == 0 and b.last % 16 == 15
+        for page in range(b.first >> 4, (b.last >> 4) + 1):
+            pages[page] = idx + 1
+    size, trie = construct_value_trie_data(pages, 0)
+    emit_value_trie(file, "block_data", trie)
+    print("block_data : size: {}".format(size))
+
+    file.write(table_storage("block_ranges", (len(blocks) + 1) * 8) + " static constexpr code_point_range block_ranges[] = {{1, 0},")
+    for b in blocks:
+        file.write("{{{}, {}}},".format(to_hex(b.first, 6), to_hex(b.last, 6)))
+    file.write("};\n")
 
 
 def compute_trie(rawdata, chunksize):
@@ -325,7 +518,7 @@ def compute_trie(rawdata, chunksize):
     return (root, child_data)
 
 
-def construct_bool_trie_data(data):
+def construct_bool_trie_data(data, layout):
     CHUNK = 64
     rawdata = [False] * 0x110000
     for cp in data:
@@ -333,6 +526,8 @@ def construct_bool_trie_data(data):
 
 
     def trim(arr):
+        if layout == "padded":
+            return (arr, 0, 0)
         import numpy
         a = numpy.trim_zeros(arr, 'f')
         f = len(arr) - len(a)
@@ -377,10 +572,12 @@ def construct_bool_trie_data(data):
     r4 = trim(r4)
     r5 = trim(r5)
 
-    size = len(r1) * 8 + len(r2) + len(r3) * 8 + len(r4) + len(r5) + len(r6) * 8
-    return (size, (r1, r2, r3, r4, r5, r6))
+    size = len(r1) * 8 + len(r2[0]) + len(r3) * 8 + len(r4[0]) + len(r5[0]) + len(r6) * 8
+    return (size, (r1, r2, r3, r4, r5, r6, layout))
 
 def emit_bool_trie(f, name, trie_data):
+    size = (len(trie_data[0]) + len(trie_data[2]) + len(trie_data[5])) * 8 + len(trie_data[1][0]) + len(trie_data[3][0]) + len(trie_data[4][0])
+    TABLES_SUMMARY.append((name, "bool_trie", size, "3 loads"))
 
     r1data = ','.join('0x%016x' % chunk for chunk in trie_data[0])
     r2data = ','.join(str(node) for node in trie_data[1][0])
@@ -388,7 +585,8 @@ def emit_bool_trie(f, name, trie_data):
     r4data = ','.join(str(node) for node in trie_data[3][0])
     r5data = ','.join(str(node) for node in trie_data[4][0])
     r6data = ','.join('0x%016x' % chunk for chunk in trie_data[5])
-    f.write("static constexpr bool_trie<{}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}> {} {{".format(
+    f.write("{} static constexpr bool_trie<{}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, trie_layout::{}> {} {{".format(
+        table_storage(name, size),
         len(trie_data[0]),      #r1
         len(trie_data[1][0]),   #r2
         trie_data[1][1],
@@ -401,13 +599,61 @@ def emit_bool_trie(f, name, trie_data):
         trie_data[4][1],
         trie_data[4][2],
         len(trie_data[5]),      #r6
+        trie_data[6],
         name))
     f.write("{{ {} }}, {{ {} }}, {{ {} }}, {{ {} }}, {{ {} }}, {{ {} }}".format(r1data, r2data, r3data, r4data, r5data, r6data))
     f.write("};")
 
 
+def construct_value_trie_data(values, default):
+    ## values holds one entry per code point (0..0x10FFFF), or per group of code points
+    ## try a few splits of the code point and keep the smallest trie
+    ## compute_trie drops incomplete chunks, pad to a multiple of the largest stage 1 block
+    values = values + [default] * (-len(values) % (1 << 13))
+    payload_size = 1 if max(values) < 0x100 else 2
+    def index_size(n):
+        return 1 if n <= 0x100 else 2
+    best = None
+    for leaf_bits in range(4, 8):
+        (mid, s3) = compute_trie(values, 1 << leaf_bits)
+        for mid_bits in range(2, 7):
+            (s1, s2) = compute_trie(mid, 1 << mid_bits)
+            # truncate stage 1 after the last block holding a non default value
+            s2_block = 1 << mid_bits
+            s3_block = 1 << leaf_bits
+            def is_default(block):
+                for leaf in s2[block * s2_block: (block + 1) * s2_block]:
+                    if any(v != default for v in s3[leaf * s3_block: (leaf + 1) * s3_block]):
+                        return False
+                return True
+            while len(s1) and is_default(s1[-1]):
+                s1.pop()
+            size = (len(s1) * index_size(len(s2) >> mid_bits) + len(s2) * index_size(len(s3) >> leaf_bits)
+                    + len(s3) * payload_size)
+            if best == None or size < best[0]:
+                best = (size, (s1, s2, s3, mid_bits, leaf_bits, payload_size))
+    return best
+
+def emit_value_trie(f, name, trie_data):
+    (s1, s2, s3, mid_bits, leaf_bits, payload_size) = trie_data
+    ## batch lookups read the stages with 32 bits loads, pad the last one so they stay in the table
+    s3 = s3 + [0] * (4 // payload_size - 1)
+    index_size = lambda n: 1 if n <= 0x100 else 2
+    size = (len(s1) * index_size(len(s2) >> mid_bits) + len(s2) * index_size(len(s3) >> leaf_bits)
+            + len(s3) * payload_size)
+    f.write("{} static constexpr value_trie<std::uint{}_t, {}, {}, {}, {}, {}> {} = {{".format(
+        table_storage(name, size), payload_size * 8, len(s1), len(s2), len(s3), mid_bits, leaf_bits, name))
+    TABLES_SUMMARY.append((name, "value_trie", size, "3 loads"))
+    f.write("{{ {} }}, {{ {} }}, {{ {} }}".format(','.join(map(str, s1)), ','.join(map(str, s2)),
+                                                  ','.join(map(str, s3))))
+    f.write("};")
+
 def emit_bool_table(f, name, data):
-    f.write("static constexpr flat_array<{}> {} {{{{".format(len(data), name))
+    ## flat_array binary searches tables of 20 elements or more, keep them sorted
+    data = sorted(data)
+    TABLES_SUMMARY.append((name, "flat_array", len(data) * 4,
+                           "{} compares".format(len(data)) if len(data) < FLAT_ARRAY_SCAN_LIMIT else search_cost(len(data))))
+    f.write("{} static constexpr flat_array<{}> {} {{{{".format(table_storage(name, len(data) * 4), len(data), name))
     for idx, cp in enumerate(data):
         f.write(to_hex(cp, 6))
         if idx != len(data) - 1: f.write(",")
@@ -427,17 +673,21 @@ def construct_range_data(data):
             prev = res
             prev_cp = i
     if len(elems) != 0: elems[-1] = (elems[-1][0], elems[-1][1], i - prev_cp)
+    ## the last entry only marks the end of the ranges, which is past U+10FFFF for nchar
+    if len(elems) != 0 and elems[-1][1]:
+        elems.append((0x110000, False, 0))
     return len(elems) * 4, elems
 
 def emit_bool_ranges(f, name, range_data):
-    f.write("static constexpr range_array {} = {{".format(name))
-    for idx, e in enumerate(range_data):
-        f.write("{}".format(to_hex((e[0] << 8) | (1 if e[1] else 0), 10)))
-        if idx != len(range_data) - 1: f.write(",")
+    TABLES_SUMMARY.append((name, "range_array", len(range_data) * 4, search_cost(len(range_data))))
+    entries = layout_ranges([(e[0] << 8) | (1 if e[1] else 0) for e in range_data])
+    f.write("{} static constexpr range_array<{}, range_layout::{}> {} = {{".format(
+        table_storage(name, len(entries) * 4), len(entries), RANGE_LAYOUT, name))
+    f.write(",".join(to_hex(e, 10) for e in entries))
     f.write("};")
 
 
-def emit_trie_or_table(f, name, data):
+def emit_trie_or_table(f, name, data, trie_layout = None):
     t = 'a'
     adata = data
     asize = len(data) * 4
@@ -449,14 +699,27 @@ def emit_trie_or_table(f, name, data):
 
     if len(data):
         rsize, rdata = construct_range_data(data)
-        tsize, tdata = construct_bool_trie_data(data)
-
-    if rsize < size:
-        t = 'r'
-        size = rsize
-    if size > 200:
-        t = 't'
-        size = tsize
+        tsize, tdata = construct_bool_trie_data(data, trie_layout or BOOL_TRIE_LAYOUT)
+
+    policy = TABLE_POLICY if name in LOOKUP_TABLES else "minimal"
+    if policy == "minimal":
+        if rsize < size:
+            t = 'r'
+            size = rsize
+        if tsize < size:
+            t = 't'
+            size = tsize
+    elif policy == "latency":
+        if len(data) >= FLAT_ARRAY_SCAN_LIMIT:
+            t = 't'
+            size = tsize
+    else:
+        if rsize < size:
+            t = 'r'
+            size = rsize
+        if size > 200:
+            t = 't'
+            size = tsize
 
     if t == 'a':
         emit_bool_table(f, name, adata)
@@ -468,6 +731,14 @@ def emit_trie_or_table(f, name, data):
     print("{} : {} element(s) - type: {} - size: {}  (array: {}, range: {}, trie : {}".format(name, len(data), t, size, asize, rsize, tsize))
     return size
 
+def write_enum_numeric_types(numeric_types_names, file):
+    f.write("enum class numeric_type {")
+    for nt in numeric_types_names:
+        f.write(nt[0] + ",")
+        if nt[1] != nt[0]:
+            f.write(nt[1] + " = " + nt[0] +",")
+    f.write("max };\n")
+
 def write_enum_categories(categories_names, file):
     f.write("enum class category {")
     for cat in categories_names:
@@ -477,21 +748,22 @@ def write_enum_categories(categories_names, file):
 
 def write_categories_data(characters, categories_names, file):
 
-    write_string_array(f, "  categories_names", [(c[0], idx) for idx, c in enumerate(categories_names)]
+    write_string_array(f, "categories_names", [(c[0], idx) for idx, c in enumerate(categories_names)]
                                               + [(c[1], idx) for idx, c in enumerate(categories_names)])
 
-    size = 0
-    cats = {}
+    indexes = dict((c[0], idx) for idx, c in enumerate(categories_names))
+    values = [indexes['cn']] * 0x110000
+    cats = set()
     for cp in characters:
         if cp.gc == 'cn':
             continue
-        if not cp.gc in cats:
-            cats[cp.gc] = []
-        cats[cp.gc].append(cp.cp)
-    sorted_by_len = []
-    for k, v in cats.items():
-        size += emit_trie_or_table(f, "cat_{}".format(k), set(v))
-        sorted_by_len.append((len(v), k))
+        values[cp.cp] = indexes[cp.gc]
+        cats.add(cp.gc)
+
+    size, trie = construct_value_trie_data(values, indexes['cn'])
+    emit_value_trie(f, "category_data", trie)
+    print("category_data : type: value_trie - size: {}".format(size))
+
     meta_cats = {
         "cased_letter" : ['lu', 'lt', 'll'],
         "letter" : ['lu', 'lt', 'll', 'lm', 'lo'],
@@ -503,32 +775,37 @@ def write_categories_data(characters, categories_names, file):
         "other"    : ['cc', 'cf', 'cs', 'co', 'cn']
     }
 
-    sorted_by_len.sort(reverse=True)
-
     f.write("""
     constexpr category get_category(char32_t c) {
+        return static_cast<category>(category_data.lookup(c, uint8_t(category::cn)));
+    }
     """)
-    for _, cat in sorted_by_len:
-        f.write("if (cat_{0}.lookup(c)) return category::{0};".format(cat))
-    f.write("return category::cn;}")
 
+    ## One bit per category, meta categories expand to the bits of their members
+    assert len(categories_names) <= 64
+    f.write(table_storage("category_mask_bits", len(categories_names) * 8) + " static constexpr std::uint64_t category_mask_bits[] = {")
+    for idx, (short, long) in enumerate(categories_names):
+        bits = 1 << idx
+        if long in meta_cats:
+            bits = 0
+            for cat in meta_cats[long]:
+                bits |= 1 << indexes[cat]
+        f.write("{},".format(to_hex(bits, 18)))
+    f.write("};")
 
     f.write("}")
 
-    for _, cat in sorted_by_len:
+    for cat in sorted(cats):
         f.write("""template <>
         constexpr bool cp_category_is<category::{0}>(char32_t c) {{
-            return detail::tables::cat_{0}.lookup(c); }}
+            return cp_category(c) == category::{0}; }}
         """.format(cat))
 
-    for name, cats in meta_cats.items():
+    for name in meta_cats.keys():
         f.write("""template <>
-        constexpr bool cp_category_is<category::{}>(char32_t c) {{
-            """.format(name))
-        for _, cat in sorted_by_len:
-            if cat in cats:
-                f.write("if(detail::tables::cat_{0}.lookup(c)) return true;".format(cat))
-        f.write("return false;}")
+        constexpr bool cp_category_is<category::{0}>(char32_t c) {{
+            return cp_category_in(c, category::{0}); }}
+        """.format(name))
 
     f.write("""
         template <>
@@ -539,7 +816,6 @@ def write_categories_data(characters, categories_names, file):
     )
 
     f.write("namespace detail::tables {")
-    print("total size : {}".format(size / 1024.0))
 
 def characters_ages(characters):
     return sorted(list(set([float(cp.age) for cp in characters if cp.age != 'unassigned'])))
@@ -565,67 +841,121 @@ def write_age_data(characters, f):
     for idx, age in enumerate(ages):
         f.write('"{}"{}'.format(age, "," if idx < len(ages) - 1 else ""))
     f.write("};\n")
+    write_string_array(f, "age_names", [("unassigned", 0)] + [(str(age), i + 1) for i, age in enumerate(ages)])
 
-    f.write("static constexpr compact_range age_data = {")
     known  = dict([(cp.cp, age_name(cp.age)) for cp in characters])
     prev  = ""
-    size = 0
+    entries = []
     for cp in range(0, 0x10FFFF):
         age = known[cp] if cp in known else 'unassigned'
         if prev != age:
-            f.write("{},".format(to_hex((cp << 8) | indexes[age], 10)))
-            size = size + 1
+            entries.append((cp << 8) | indexes[age])
             prev = age
-    f.write("0xFFFFFFFF};\n")
-    print(size)
-
-def write_numeric_data(characters, f):
-
-    values = dict({
-        "8"   : [],
-        "16"  : [],
-        "32"  : [],
-        "64"  : []
-    })
-    dvalues = []
-
+    entries.append(0xFFFFFFFF)
+    emit_compact_range(f, "age_data", entries)
+    print(len(entries) - 1)
+
+def write_numeric_data(characters, numeric_types_names, f):
+    ## One record per distinct (numerator, denominator, numeric type),
+    ## a value trie maps each code point to the index of its record.
+    ## The first record is the one of code points without a numeric value.
+    nts = dict((n[0], idx) for idx, n in enumerate(numeric_types_names))
+    records = {(0, 0, nts['none']): 0}
+    values = [0] * 0x110000
     for cp in characters:
         if not cp.nv:
             continue
         n = int(cp.nv[0])
         d = int(cp.nv[1] if len(cp.nv) == 2 else '1')
-        if d != 1:
-            dvalues.append((cp.cp, d))
-        if abs(n) > 2147483647:
-            values["64"].append((cp.cp, n))
-        elif abs(n) > 32767:
-            values["32"].append((cp.cp, n))
-        elif n < 0 or n >= 127 :
-            values["16"].append((cp.cp, n))
-        else:
-            values["8"].append((cp.cp, n))
-
-    for s, characters in values.items():
-        if s == '8' :
-            f.write("static constexpr compact_list numeric_data8 = {")
-        else:
-            f.write("static constexpr uni::detail::pair<char32_t, int{0}_t> numeric_data{0}[] = {{ ".format(s))
-
-
-        for idx, cp in enumerate(characters):
-            if s == '8' :
-                f.write("{}{}".format(to_hex(((cp[0] << 8) | cp[1]) , 10), ',' if idx < len(characters) - 1 else ''))
-            else:
-                f.write("uni::detail::pair<char32_t, int{}_t> {{ {}, {} }},".format(s, to_hex(cp[0], 6), cp[1]))
-        f.write("};")
+        assert d < 32768
+        record = (n, d, nts[cp.nt])
+        if record not in records:
+            records[record] = len(records)
+        values[cp.cp] = records[record]
+
+    f.write(table_storage("numeric_records", len(records) * 16) + " static constexpr numeric_record numeric_records[] = {")
+    for record, _ in sorted(records.items(), key = lambda r: r[1]):
+        f.write("{{ {}ll, {}, {} }},".format(*record))
+    f.write("};")
+    size, trie = construct_value_trie_data(values, 0)
+    emit_value_trie(f, "numeric_data", trie)
+
+    ## Most code points have no numeric value, one bit per page of 256 code points
+    ## holding at least one of them lets lookups reject the others without walking the trie
+    pages = [0] * (0x110000 >> 14)
+    for c, v in enumerate(values):
+        if v != 0:
+            pages[c >> 14] |= 1 << ((c >> 8) & 63)
+    f.write(table_storage("numeric_pages", len(pages) * 8) + " static constexpr std::uint64_t numeric_pages[] = {")
+    f.write(",".join(to_hex(p, 18) for p in pages))
+    f.write("};")
+    print("numeric_data : {} record(s) - type: value_trie - size: {} (+ {} bytes of pages)".format(
+        len(records), size, len(pages) * 8))
 
-    f.write("static constexpr uni::detail::pair<char32_t, int16_t> numeric_data_d[] = {")
-    for cp in dvalues:
-        f.write("uni::detail::pair<char32_t, int16_t> {{ {}, {} }},".format(to_hex(cp[0], 6), cp[1]))
-    f.write("uni::detail::pair<char32_t, int16_t>{0x110000, 0} };\n")
 
+def script_extensions_sets(characters, scripts_names):
+    ## Every distinct Script_Extensions set gets an id,
+    ## 0 is the empty set of unassigned code points
+    indexes = {}
+    for i, script in enumerate(scripts_names):
+        indexes[script[0]] = i
+        indexes[script[1]] = i
+    sets = {(): 0}
+    ids = {}
+    for cp in characters:
+        if cp.reserved:
+            continue
+        scx = cp.scx[1:] if len(cp.scx) > 1 else cp.scx
+        key = tuple(sorted(set(indexes[s] for s in scx)))
+        if key not in sets:
+            sets[key] = len(sets)
+        ids[cp.cp] = sets[key]
+    return (sorted(sets.keys(), key = lambda k: sets[k]), ids)
+
+def write_cp_info_data(characters, blocks, categories_names, scripts_names, numeric_types_names, f):
+    ## One record per distinct (category, script, block, age, numeric type, scx set)
+    ## a value trie maps each code point to the index of its record.
+    ## The first record is the one of code points not in the database.
+    cats = dict((c[0], idx) for idx, c in enumerate(categories_names))
+    scripts = dict([(s[0], idx) for idx, s in enumerate(scripts_names)] + [(s[1], idx) for idx, s in enumerate(scripts_names)])
+    nts = dict((n[0], idx) for idx, n in enumerate(numeric_types_names))
+    ages = dict((age_name(age), i + 1) for i, age in enumerate(characters_ages(characters)))
+    ages['unassigned'] = 0
+    block_of = [0] * 0x110000
+    for idx, b in enumerate(blocks):
+        for cp in range(b.first, b.last + 1):
+            block_of[cp] = idx + 1
+    _, scx_ids = script_extensions_sets(characters, scripts_names)
+
+    default = (cats['cn'], scripts['zzzz'], 0, 0, nts['none'], 0)
+    records = {default: 0}
+    values = [0] * 0x110000
+    known = dict((cp.cp, cp) for cp in characters)
+    for c in range(0x110000):
+        if c in known:
+            cp = known[c]
+            reserved = cp.reserved
+            record = (cats[cp.gc], scripts['zzzz'] if reserved else scripts[cp.sc], block_of[c],
+                      ages[age_name(cp.age)], nts['none'] if reserved else nts[cp.nt],
+                      0 if reserved else scx_ids[c])
+        else:
+            record = default[:2] + (block_of[c],) + default[3:]
+        if record not in records:
+            records[record] = len(records)
+        values[c] = records[record]
+
+    f.write(table_storage("cp_info_records", len(records) * 8) + " static constexpr code_point_record cp_info_records[] = {")
+    for record, _ in sorted(records.items(), key = lambda r: r[1]):
+        f.write("{{ {}, {}, {}, {}, {}, {} }},".format(*record))
+    f.write("};")
+    size, trie = construct_value_trie_data(values, 0)
+    emit_value_trie(f, "cp_info_data", trie)
+    print("cp_info_data : {} records - size: {} (records: {})".format(len(records), size, len(records) * 8))
+    ## the record index and the record of U+0000..U+00FF, records are in index order
+    by_index = list(records.keys())
+    return [(values[c], by_index[values[c]]) for c in range(0x100)]
 
-def write_binary_properties(characters, f):
+def write_binary_properties(characters, latin1_info, f):
 
     unsupported_props = [
         "gr_link", # Grapheme_Link is deprecated
@@ -656,19 +986,6 @@ def write_binary_properties(characters, f):
         "oupper"
     ]
 
-    custom_impl = [
-        "cased",
-        "ci",
-        "di",
-        "idc",
-        "ids",
-        "lower",
-        "upper",
-        "math",
-        "nchar",
-        "gr_ext"
-    ]
-
     props = []
 
     lines = [line.rstrip('\n') for line in open(BINARY_PROPS_FILE, 'r')]
@@ -698,28 +1015,72 @@ def write_binary_properties(characters, f):
     f.write("max };\n")
 
 
+    ## The rows answer every property query, the properties get no table of their own
     f.write("namespace detail::tables {")
-    for prop in props:
-        if not prop in custom_impl:
-            emit_binary_data(f, "prop_{}_data".format(prop), characters, lambda c : prop in c.props and c.props[prop])
+
+    ## All the properties of a code point as one bit per property enumerator.
+    ## Identical rows are shared, and a value trie maps each code point to its row.
+    ## Noncharacters are not part of the database and are handled here.
+    ## property::max too must fit the shifts of property_set.
+    enumerated = [prop for prop in props if not prop in details]
+    assert len(enumerated) < 64
+    rows = [0] * 0x110000
+    for cp in characters:
+        for idx, prop in enumerate(enumerated):
+            if prop in cp.props and cp.props[prop]:
+                rows[cp.cp] |= 1 << idx
+    nchar = 1 << enumerated.index("nchar")
+    for cp in range(0x110000):
+        if (cp & 0xFFFE) == 0xFFFE or (cp >= 0xFDD0 and cp <= 0xFDEF):
+            rows[cp] |= nchar
+
+    latin1_rows = rows[:0x100]
+    distinct = {0: 0}
+    for idx, row in enumerate(rows):
+        if row not in distinct:
+            distinct[row] = len(distinct)
+        rows[idx] = distinct[row]
+    f.write(table_storage("property_rows", len(distinct) * 8) + " static constexpr std::uint64_t property_rows[] = {")
+    f.write(",".join(to_hex(row, 18) for row, _ in sorted(distinct.items(), key = lambda r: r[1])))
+    f.write("};")
+    size, trie = construct_value_trie_data(rows, 0)
+    emit_value_trie(f, "property_data", trie)
+    print("property_data : {} rows - size: {} (rows: {})".format(len(distinct), size, len(distinct) * 8))
+
+    ## Everything about U+0000..U+00FF in one record per code point, checked before the other tables
+    f.write(table_storage("latin1_data", len(latin1_rows) * 16) + " static constexpr latin1_record latin1_data[] = {")
+    for row, (idx, record) in zip(latin1_rows, latin1_info):
+        assert record[2] < 0x100
+        f.write("{{ {}, {}, {}, {}, {}, {} }},".format(to_hex(row, 18), record[0], record[1], record[2], record[3], idx))
+    f.write("};")
     f.write("}")
 
 
-    for prop in props:
-        if not prop in custom_impl and not prop in details:
-            f.write("template <> constexpr bool cp_property_is<property::{0}>(char32_t c) {{ return detail::tables::prop_{0}_data.lookup(c); }}".format(prop))
+    for prop in enumerated:
+        f.write("template <> constexpr bool cp_property_is<property::{0}>(char32_t c) {{ return cp_properties(c).contains(property::{0}); }}".format(prop))
 
 
     return [prop for prop in values if not prop[0] in details and not prop[0] in unsupported_props]
 
 
 def write_regex_support(f, characters, supported_properties, categories_names, scripts_names):
-    all = supported_properties + [["any"], ["ascii"], ["assigned"]] + categories_names + scripts_names
+    ## \p{scx=X} and \p{script_extensions=X} are looked up as binary properties named scx_X
+    scx_names = [["scx_" + script[0]] + [prefix + "=" + name for prefix in ["scx", "script_extensions"]
+                                          for name in dict.fromkeys(script)]
+                 for script in scripts_names]
+    all = (supported_properties + [["any"], ["ascii"], ["assigned"]] + categories_names + scripts_names
+           + scx_names)
 
     d = collections.OrderedDict()
     for p in all:
         d[p[0]] = p
 
+    ## How cp_has_binary_prop answers each binary property, indexed by binary_prop
+    kinds = dict([(p[0], ("property", "property")) for p in supported_properties]
+                 + [(n, (n, None)) for n in ["any", "ascii", "assigned"]]
+                 + [(c[0], ("category", "category")) for c in categories_names]
+                 + [(s[0], ("script", "script")) for s in scripts_names]
+                 + [("scx_" + s[0], ("script_extensions", "script")) for s in scripts_names])
 
     f.write("enum class binary_prop {")
     for p in d.keys():
@@ -739,7 +1100,7 @@ def write_regex_support(f, characters, supported_properties, categories_names, s
         f.write("""
         template<>
         constexpr bool get_binary_prop<binary_prop::{0}>(char32_t c) {{
-            return cp_category_is<category::{0}>(c);
+            return cp_category_in(c, category::{0});
         }}
     """.format(cat[0]))
 
@@ -751,18 +1112,32 @@ def write_regex_support(f, characters, supported_properties, categories_names, s
         }}
     """.format(script[0]))
 
+    for script in scripts_names:
+        f.write("""
+        template<>
+        constexpr bool get_binary_prop<binary_prop::scx_{0}>(char32_t c) {{
+            return cp_script_extensions(c).contains(script::{0});
+        }}
+    """.format(script[0]))
+
     names = []
     for idx, (_, aliases) in enumerate(d.items()):
         names = names + [(n, idx) for n in aliases]
 
     f.write("namespace tables{")
     write_string_array(f, "binary_prop_names", names)
+    f.write("static constexpr binary_prop_descriptor binary_prop_descriptors[] = {")
+    for p in d.keys():
+        kind, enum = kinds[p]
+        value = "std::uint8_t({}::{})".format(enum, p[4:] if kind == "script_extensions" else p) if enum else "0"
+        f.write("{{ binary_prop_kind::{}, {} }},".format(kind, value))
+    f.write("};")
     f.write("}")
 
 
-def emit_binary_data(f, name, characters, pred):
+def emit_binary_data(f, name, characters, pred, trie_layout = None):
     d = set([c.cp for c in filter(pred, characters)])
-    emit_trie_or_table(f, name, d)
+    emit_trie_or_table(f, name, d, trie_layout)
 
 if __name__ == "__main__":
 
@@ -772,6 +1147,7 @@ if __name__ == "__main__":
     characters = list(filter(lambda c : c != None, all_characters))
 
     categories_name = get_cats_names()
+    numeric_types_names = get_numeric_types_names()
 
     with open(sys.argv[1], "w") as f:
         f.write("""
@@ -785,7 +1161,8 @@ namespace uni {
         write_enum_categories(categories_name,f)
         indexed_block_name = write_enum_blocks(block_names, blocks,f)
         write_enum_scripts(scripts_names, f)
-
+        write_enum_numeric_types(numeric_types_names, f)
+        f.write("inline constexpr table_policy tables_policy = table_policy::{};\n".format(TABLE_POLICY))
 
 
         f.write("namespace detail::tables {")
@@ -799,21 +1176,28 @@ namespace uni {
         print("Block data")
         write_blocks_data(indexed_block_name, blocks, f)
 
+        print("Code point info")
+        latin1_info = write_cp_info_data(characters, blocks, categories_name, scripts_names, numeric_types_names, f)
+
         characters = list(filter(lambda c: not c.reserved, characters))
 
         print("Script data")
         write_script_data(characters, scripts_names, f)
+        write_script_and_age_lookups(f)
 
         print("Numeric Data")
-        write_numeric_data(characters, f)
+        write_numeric_data(characters, numeric_types_names, f)
 
 
         print("Binary properties")
-        emit_binary_data(f, "prop_assigned", characters, lambda c : True)
+        ## cp_is_assigned looks up U+0000..U+00FF in latin1_data, the trie sees mixed scripts,
+        ## on which the branch free lookups of the padded layout are faster
+        emit_binary_data(f, "prop_assigned", characters, lambda c : True, "padded")
 
         # exit detail ns
         f.write("}")
-        supported_properties = write_binary_properties(characters, f)
+        supported_properties = write_binary_properties(characters, latin1_info, f)
+        write_tables_summary(f)
 
         f.write("}//namespace uni")
 